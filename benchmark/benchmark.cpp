@@ -160,4 +160,77 @@ static void BM_Order2Backward4Point(benchmark::State& state) {
     }
 }
 // Register the function as a benchmark
-BENCHMARK(BM_Order2Backward4Point);
\ No newline at end of file
+BENCHMARK(BM_Order2Backward4Point);
+// =====================================================================================================================
+// Batched solving of small nonlinear systems, compared against solving the problems one at a time.
+// =====================================================================================================================
+
+#include <Multiroots.hpp>
+#include <ThreadPool.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace
+{
+    struct BatchParams
+    {
+        double a;
+        double b;
+    };
+
+    auto batchSystem = [](std::span< const double > x, const BatchParams& p, std::span< double > f) {
+        f[0] = 3 * x[0] - std::cos(x[1] * x[2]) - p.a;
+        f[1] = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2] = std::exp(-x[0] * x[1]) + 20 * x[2] + p.b;
+    };
+
+    std::vector< BatchParams > batchParams(size_t count)
+    {
+        std::vector< BatchParams > params(count);
+        for (size_t i = 0; i < count; ++i) params[i] = { 0.4 + 0.2 * static_cast< double >(i) / static_cast< double >(count), 9.47 };
+        return params;
+    }
+}    // namespace
+
+static void BM_MultisolveScalarLoop(benchmark::State& state) {
+    using namespace nxx::multiroots;
+    const auto params = batchParams(static_cast< size_t >(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& p : params) {
+            auto system = MultiFunctionSystem([&p](std::span< const double > x, std::span< double > f) { batchSystem(x, p, f); });
+            auto result = multisolve< MultiNewton, 3 >(system, { 0.1, 0.1, -0.1 }, 1E-12, 100);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultisolveScalarLoop)->Arg(4096);
+
+static void BM_MultisolveBatch(benchmark::State& state) {
+    using namespace nxx::multiroots;
+    const auto params = batchParams(static_cast< size_t >(state.range(0)));
+    const std::vector< std::array< double, 3 > >                           guesses(params.size(), { 0.1, 0.1, -0.1 });
+    std::vector< MultirootResult< double, blaze::StaticVector< double, 3 > > > results(params.size());
+    for (auto _ : state) {
+        auto converged = multisolve_batch< MultiNewton, 3 >(batchSystem, params, guesses, results, 1E-12, 100);
+        benchmark::DoNotOptimize(converged);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultisolveBatch)->Arg(4096);
+
+static void BM_MultisolveBatchThreadPool(benchmark::State& state) {
+    using namespace nxx::multiroots;
+    nxx::ThreadPool pool;
+    const auto      params = batchParams(static_cast< size_t >(state.range(0)));
+    const std::vector< std::array< double, 3 > >                           guesses(params.size(), { 0.1, 0.1, -0.1 });
+    std::vector< MultirootResult< double, blaze::StaticVector< double, 3 > > > results(params.size());
+    for (auto _ : state) {
+        auto converged = multisolve_batch< MultiNewton, 3 >(batchSystem, params, guesses, results, 1E-12, 100, &pool);
+        benchmark::DoNotOptimize(converged);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultisolveBatchThreadPool)->Arg(4096)->UseRealTime();
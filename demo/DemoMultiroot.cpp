@@ -29,27 +29,27 @@ int main()
 
     MultiFunctionArray functions { f1, f2, f3 };
 
-    auto result1 = multisolve<SteepestDescent>(functions, { 2.0, 2.0, 2.0 });
-    auto result2 = multisolve<MultiNewton>(functions, *result1);
+    auto result = multisolve< Dogleg >(functions, { 2.0, 2.0, 2.0 });
 
-    std::cout << "Root:\n" << *result2 << std::endl;
-    std::cout << "Result:\n" << functions(*result2) << std::endl;
+    std::cout << "Iterations: " << result->iterations << (result->converged ? " (converged)" : " (not converged)") << "\n";
+    std::cout << "Root:\n" << result->root << "\n";
+    std::cout << "Residual: " << result->residual << std::endl;
 
     // auto               f1 = [](std::span< double > coeffs) { return 1 - coeffs[0]; };
     // auto               f2 = [](std::span< double > coeffs) { return 10 * (coeffs[1] - coeffs[0] * coeffs[0]); };
     // MultiFunctionArray functions { f1, f2 };
     //
     // auto result = multisolve< MultiNewton >(functions, { -10.0, -5.0 });
-    // std::cout << "Root:\n" << *result << std::endl;
-    // std::cout << "Result:\n" << functions(*result) << std::endl;
+    // std::cout << "Root:\n" << result->root << std::endl;
+    // std::cout << "Result:\n" << functions(result->root) << std::endl;
 
     // auto               f1 = [](std::span< double > coeffs) { return pow(coeffs[0], 2) + coeffs[0] * coeffs[1] - 10; };
     // auto               f2 = [](std::span< double > coeffs) { return coeffs[1] + 3 * coeffs[0] * pow(coeffs[1], 2) - 57; };
     // MultiFunctionArray functions { f1, f2 };
     //
     // auto result = multisolve< MultiNewton >(functions, { 10., 10. });
-    // std::cout << "Root:\n" << *result << std::endl;
-    // std::cout << "Result:\n" << functions(*result) << std::endl;
+    // std::cout << "Root:\n" << result->root << std::endl;
+    // std::cout << "Result:\n" << functions(result->root) << std::endl;
 
     return 0;
 }
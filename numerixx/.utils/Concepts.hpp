@@ -35,11 +35,23 @@
 #include <boost/multiprecision/cpp_bin_float.hpp>
 #include <complex>
 #include <span>
+#include <type_traits>
 
 namespace nxx
 {
+    /**
+     * @brief Customization point for user-defined scalar types that should be treated as floating point numbers.
+     * @details Specialize this struct (deriving from std::true_type) for types that behave like floating point
+     * numbers, such as the active scalar types used for automatic differentiation.
+     * @tparam T The type to check.
+     */
+    template< typename T >
+    struct IsFloatExtension : std::false_type
+    {
+    };
+
     template< typename T >
-    concept IsFloat = std::floating_point< T > || boost::multiprecision::is_number< T >::value;
+    concept IsFloat = std::floating_point< T > || boost::multiprecision::is_number< T >::value || IsFloatExtension< T >::value;
 
     //    template<typename T, typename F>
     //    concept IsFloatFunction = requires(F f, const std::vector<T>& v) {
@@ -0,0 +1,206 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file ThreadPool.hpp
+ * @brief This file contains the declaration of the ThreadPool class.
+ *
+ * The ThreadPool class holds a fixed number of worker threads, which are used by the numerical
+ * algorithms to distribute independent work (e.g. independent problems or function evaluations)
+ * without creating new threads for every call.
+ */
+
+#ifndef NUMERIXX_THREADPOOL_HPP
+#define NUMERIXX_THREADPOOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nxx
+{
+    /**
+     * @class ThreadPool
+     * @brief A fixed-size pool of worker threads, executing loops with independent iterations.
+     *
+     * @details The pool only exposes a blocking `parallel_for`. The calling thread takes part in the work,
+     *          and helps executing queued tasks while it waits, so calls to `parallel_for` may be nested
+     *          without the risk of deadlock.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @brief Constructs a ThreadPool with a given number of threads, including the calling thread.
+         * @param threads The number of threads; defaults to the number of hardware threads.
+         */
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+        {
+            threads = std::max< size_t >(threads, 1);
+            m_workers.reserve(threads - 1);
+            for (size_t i = 1; i < threads; ++i) m_workers.emplace_back([this] { work(); });
+        }
+
+        /**
+         * @brief Destructor; stops and joins all worker threads.
+         */
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_stop = true;
+            }
+            m_condition.notify_all();
+            for (auto& worker : m_workers) worker.join();
+        }
+
+        ThreadPool(const ThreadPool&)            = delete; /**< Copy constructor (deleted). */
+        ThreadPool(ThreadPool&&)                 = delete; /**< Move constructor (deleted). */
+        ThreadPool& operator=(const ThreadPool&) = delete; /**< Copy assignment operator (deleted). */
+        ThreadPool& operator=(ThreadPool&&)      = delete; /**< Move assignment operator (deleted). */
+
+        /**
+         * @brief Returns the number of threads used by the pool, including the calling thread.
+         * @return The number of threads.
+         */
+        [[nodiscard]]
+        size_t size() const noexcept
+        {
+            return m_workers.size() + 1;
+        }
+
+        /**
+         * @brief Calls `func(i)` for all i in [0, count), distributed over the threads of the pool.
+         * @details The range is split into (at most) one contiguous chunk per thread. The function returns when all
+         *          calls have completed. If any of the calls throws, the first exception is rethrown.
+         * @param count The number of iterations.
+         * @param func The loop body, invocable with a size_t.
+         */
+        template< typename FUNC_T >
+        void parallel_for(size_t count, FUNC_T&& func)
+        {
+            const size_t chunks = std::min(count, size());
+            if (chunks <= 1) {
+                for (size_t i = 0; i < count; ++i) func(i);
+                return;
+            }
+
+            std::mutex              mutex;
+            std::condition_variable done;
+            size_t                  remaining = chunks;
+            std::exception_ptr      error;
+
+            auto runChunk = [&](size_t chunk) {
+                try {
+                    for (size_t i = chunk * count / chunks; i < (chunk + 1) * count / chunks; ++i) func(i);
+                }
+                catch (...) {
+                    std::lock_guard lock(mutex);
+                    if (!error) error = std::current_exception();
+                }
+                std::lock_guard lock(mutex);
+                if (--remaining == 0) done.notify_all();
+            };
+
+            {
+                std::lock_guard lock(m_mutex);
+                for (size_t chunk = 1; chunk < chunks; ++chunk) m_tasks.emplace_back([&runChunk, chunk] { runChunk(chunk); });
+            }
+            m_condition.notify_all();
+            runChunk(0);
+
+            // Help executing queued tasks until all chunks of this loop have completed.
+            while (true) {
+                {
+                    std::unique_lock lock(mutex);
+                    if (remaining == 0) break;
+                }
+                if (!runPending()) {
+                    std::unique_lock lock(mutex);
+                    done.wait(lock, [&] { return remaining == 0; });
+                    break;
+                }
+            }
+
+            if (error) std::rethrow_exception(error);
+        }
+
+    private:
+        std::vector< std::thread >            m_workers;        /**< The worker threads. */
+        std::deque< std::function< void() > > m_tasks;          /**< Tasks waiting to be executed. */
+        std::mutex                            m_mutex;          /**< Mutex protecting the task queue. */
+        std::condition_variable               m_condition;      /**< Signals new tasks, or that the pool is stopping. */
+        bool                                  m_stop { false }; /**< Whether the pool is being destroyed. */
+
+        /**
+         * @brief Executes one queued task, if any.
+         * @return true if a task was executed, otherwise false.
+         */
+        bool runPending()
+        {
+            std::function< void() > task;
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_tasks.empty()) return false;
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+            return true;
+        }
+
+        /**
+         * @brief The loop executed by each of the worker threads.
+         */
+        void work()
+        {
+            while (true) {
+                std::function< void() > task;
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                    if (m_stop && m_tasks.empty()) return;
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+                task();
+            }
+        }
+    };
+
+}    // namespace nxx
+
+#endif    // NUMERIXX_THREADPOOL_HPP
@@ -0,0 +1,178 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GAUSSLEGENDRE_HPP
+#define GAUSSLEGENDRE_HPP
+
+// ===== Numerixx Includes
+#include <Concepts.hpp>
+
+// ===== External Includes
+#include <gcem.hpp>
+
+// ===== Standard Library Includes
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <numbers>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file GaussLegendre.hpp
+ * @brief Header file defining the fixed-order Gauss-Legendre quadrature rule.
+ *
+ * This file contains the GaussLegendre class template, which integrates a function by a single application
+ * of the N-point Gauss-Legendre rule. The nodes and weights are computed at compile time, and the weighted
+ * sum is unrolled, so that an integral costs N function evaluations and nothing else. The rule is exact
+ * for polynomials of degree 2N - 1, and converges very quickly for smooth (analytic) integrands.
+ */
+namespace nxx::integrate
+{
+    namespace detail
+    {
+        /**
+         * @brief Computes the non-negative nodes and the corresponding weights of the N-point Gauss-Legendre rule on [-1, 1].
+         *
+         * @details The nodes are the roots of the Legendre polynomial P_N, which are found by Newton's method, starting
+         *          from the asymptotic approximation cos(pi * (i - 1/4) / (N + 1/2)) of the i'th root. P_N and its
+         *          derivative are evaluated by the three-term recurrence. The weights are 2 / ((1 - x^2) * P_N'(x)^2).
+         *          The computations are carried out in long double, at compile time.
+         *
+         * @tparam N The number of points of the rule.
+         * @return A pair of arrays with the (N + 1) / 2 non-negative nodes in decreasing order, and the weights.
+         */
+        template<size_t N>
+        consteval auto computeGaussLegendre()
+        {
+            using T = long double;
+            constexpr size_t M = (N + 1) / 2;
+
+            std::array< T, M > nodes{};
+            std::array< T, M > weights{};
+
+            for (size_t i = 0; i < M; ++i) {
+                T x  = gcem::cos(std::numbers::pi_v< T > * (static_cast< T >(i) + T(0.75)) / (static_cast< T >(N) + T(0.5)));
+                T dp = 1;
+                for (int iter = 0; iter < 100; ++iter) {
+                    T p0 = 1;
+                    T p1 = x;
+                    for (size_t k = 2; k <= N; ++k) {
+                        const T p2 = ((2 * k - 1) * x * p1 - (k - 1) * p0) / k;
+                        p0         = p1;
+                        p1         = p2;
+                    }
+                    dp               = N * (x * p1 - p0) / (x * x - 1);
+                    const T previous = x;
+                    x -= p1 / dp;
+                    if (previous == x) break;
+                }
+
+                // The middle node of a rule with an odd number of points is zero.
+                if (N % 2 == 1 && i == M - 1) x = 0;
+                nodes[i]   = x;
+                weights[i] = 2 / ((1 - x * x) * dp * dp);
+            }
+
+            return std::pair{ nodes, weights };
+        }
+    } // namespace detail
+
+    /**
+     * @class GaussLegendre
+     * @brief Fixed-order (non-iterative) numerical integration using the N-point Gauss-Legendre rule.
+     *
+     * @details As opposed to the iterative solvers, the rule is applied once, with no refinement and no error
+     *          estimate; it is intended for smooth integrands that are integrated many times, e.g. inside other
+     *          solvers, where the accuracy of a given order is known in advance. The nodes and weights are
+     *          computed at compile time, and stored in static arrays. The weighted sum is unrolled at compile
+     *          time as well, and accumulated by fused multiply-adds for the built-in floating point types.
+     *
+     *          The rule can be used directly, e.g. `GaussLegendre< 10 >{}(f, 0.0, 1.0)`, or through the
+     *          `integrate` and `integralOf` functions, e.g. `integrate< GaussLegendre< 10 > >(f, { 0.0, 1.0 })`.
+     *
+     * @tparam N The number of points of the rule, which is exact for polynomials of degree 2N - 1.
+     */
+    template<size_t N>
+        requires (N > 0)
+    class GaussLegendre
+    {
+        static constexpr auto Rule = detail::computeGaussLegendre< N >();
+
+    public:
+        static constexpr bool IsQuadratureRule = true; /**< Flag indicating the class is a non-iterative quadrature rule. */
+
+        static const inline std::string SolverName = "GaussLegendre"; /**< Name of the rule. */
+
+        static constexpr std::array< long double, (N + 1) / 2 > Nodes   = Rule.first;  /**< Non-negative nodes, in decreasing order. */
+        static constexpr std::array< long double, (N + 1) / 2 > Weights = Rule.second; /**< The weights of the nodes. */
+
+        /**
+         * @brief Integrates a function over the interval [lower, upper].
+         *
+         * @tparam FN The type of function to be integrated.
+         * @tparam ARG_T The type of the argument for the function.
+         * @param function The function to be integrated.
+         * @param lower The lower bound of integration.
+         * @param upper The upper bound of integration.
+         * @return The estimate of the integral.
+         */
+        template<IsFloatInvocable FN, IsFloat ARG_T>
+        auto operator()(const FN& function, ARG_T lower, ARG_T upper) const
+        {
+            using RESULT_T = std::invoke_result_t< FN, ARG_T >;
+
+            const ARG_T center   = (lower + upper) / 2;
+            const ARG_T halfSize = (upper - lower) / 2;
+
+            // Accumulates weight * (f(center - h * x) + f(center + h * x)) for the I'th pair of nodes.
+            auto accumulate = [&]< size_t I >(RESULT_T sum) {
+                const ARG_T    offset = halfSize * static_cast< ARG_T >(Nodes[I]);
+                const RESULT_T weight = static_cast< RESULT_T >(Weights[I]);
+                const RESULT_T values = function(center - offset) + function(center + offset);
+                if constexpr (std::floating_point< RESULT_T >)
+                    return std::fma(weight, values, sum);
+                else
+                    return sum + weight * values;
+            };
+
+            RESULT_T sum = 0.0;
+            if constexpr (N % 2 == 1) sum = static_cast< RESULT_T >(Weights[N / 2]) * function(center);
+            [&]< size_t... I >(std::index_sequence< I... >) {
+                ((sum = accumulate.template operator()< I >(sum)), ...);
+            }(std::make_index_sequence< N / 2 >{});
+
+            return sum * halfSize;
+        }
+    };
+} // namespace nxx::integrate
+
+#endif //GAUSSLEGENDRE_HPP
@@ -32,6 +32,7 @@
 #define NUMERIXX_INTEGRATION_HPP
 
 // ===== Local Includes
+#include "GaussLegendre.hpp"
 #include "IntegrationTraits.hpp"
 #include "IntegrationError.hpp"
 #include "IntegrationValidation.hpp"
@@ -40,19 +41,25 @@
 #include <Concepts.hpp>
 #include <Constants.hpp>
 #include <Error.hpp>
+#include <ThreadPool.hpp>
 
 // ===== External Includes
 #include <tl/expected.hpp>
-#include <boost/multi_array.hpp>
 
 // ===== Standard Library Includes
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <numbers>
 #include <numeric>
 #include <random>
 #include <type_traits>
 #include <span>
+#include <utility>
+#include <vector>
 
 /**
  * @file Integration.hpp
@@ -67,7 +74,8 @@
  *
  * The file contains:
  * - Base class templates for integration solvers (IntegrationBase).
- * - Specific integration algorithm implementations (Trapezoid, Simpson, Romberg).
+ * - Specific integration algorithm implementations (Trapezoid, Simpson, Romberg, GaussKronrod, TanhSinh).
+ * - Overloads of the integrate function for fixed-order quadrature rules (GaussLegendre).
  * - Generic integration function templates (integrate) that work with various solver classes.
  * - Overloads of the integrate function to support different types of bounds (e.g., arrays, structures).
  * - A functor class template (IntegrationFunctor) for encapsulating integration algorithms as callable objects.
@@ -76,16 +84,13 @@
  * @note
  * This file is designed to be included as a single header, providing all necessary tools for
  * numerical integration without the need for multiple includes. It relies on several external
- * dependencies, including the standard library, Boost (for multi_array), and tl::expected for
- * error handling.
+ * dependencies, including the standard library and tl::expected for error handling.
  *
  * @warning
  * The user must ensure that the function to be integrated and the integration bounds are
  * compatible with the algorithms used. Improper use or configuration may result in inaccurate
  * results or runtime errors.
  *
- * @todo Consider approaches to improve memory usage, especially for the Trapezoid and Simpson classes.
- * @todo Consider implementing a parallel version of the integration algorithms.
  * @todo Implement performance tests and benchmarks.
  */
 
@@ -106,6 +111,32 @@ namespace nxx::integrate
         //
         // =============================================================================================================
 
+        /**
+         * @brief Sums `valueOf(i)` for i in [first, first + count) by pairwise summation.
+         * @details The range is split so that the left part is the largest power of two smaller than `count`, and
+         *          ranges of up to 128 terms are summed sequentially, which keeps the overhead small for cheap terms.
+         *          The order of the additions thus depends on `count` only, and the result is the same whether the
+         *          values are computed on the fly or read from a buffer.
+         * @param first The first index.
+         * @param count The number of terms.
+         * @param valueOf Invocable returning the term with a given index.
+         * @return The sum of the terms.
+         */
+        template<typename VALUE_FN>
+        auto pairwiseSum(uint64_t first, uint64_t count, const VALUE_FN& valueOf) -> decltype(valueOf(first))
+        {
+            using SUM_T = decltype(valueOf(first));
+            if (count <= 128) {
+                SUM_T sum = 0.0;
+                for (uint64_t i = first; i < first + count; ++i) sum += valueOf(i);
+                return sum;
+            }
+
+            uint64_t left = 1;
+            while (2 * left < count) left *= 2;
+            return pairwiseSum(first, left, valueOf) + pairwiseSum(first + left, count - left, valueOf);
+        }
+
         /**
          * @class IntegrationBase
          * @brief Template base class for numerical integration solvers.
@@ -139,10 +170,11 @@ namespace nxx::integrate
             ~IntegrationBase() = default; /**< Protected destructor to prevent direct instantiation. */
 
         private:
-            FUNCTION_T m_func{};     /**< The function object to integrate. */
-            BOUNDS_T   m_bounds{};   /**< Holds the current bounds of the integration. */
-            RESULT_T   m_estimate{}; /**< Holds the current estimate of the integral. */
-            ARG_T      m_interval{}; /**< Holds the current interval size. */
+            FUNCTION_T  m_func{};     /**< The function object to integrate. */
+            BOUNDS_T    m_bounds{};   /**< Holds the current bounds of the integration. */
+            RESULT_T    m_estimate{}; /**< Holds the current estimate of the integral. */
+            ARG_T       m_interval{}; /**< Holds the current interval size. */
+            ThreadPool* m_pool{};     /**< Optional thread pool for evaluating the function at the abscissae of a level. */
 
         public:
             /**
@@ -181,7 +213,13 @@ namespace nxx::integrate
                 validateRange(lower, upper);
                 m_bounds   = BOUNDS_T{ lower, upper };
                 m_interval = upper - lower;
-                m_estimate = m_interval * (evaluate(lower) + evaluate(upper)) / 2;
+
+                // Solvers that never evaluate the function at the endpoints (e.g. for integrands that are singular
+                // there) declare EvaluatesEndpoints = false, and start from a zero estimate.
+                if constexpr (requires { requires !DERIVED::EvaluatesEndpoints; })
+                    m_estimate = 0.0;
+                else
+                    m_estimate = m_interval * (evaluate(lower) + evaluate(upper)) / 2;
             }
 
             /**
@@ -191,6 +229,59 @@ namespace nxx::integrate
              */
             RESULT_T evaluate(ARG_T value) const { return m_func(value); }
 
+            /**
+             * @brief Evaluates the function at `count` abscissae, and returns the sum of the function values.
+             * @details If a thread pool is set, the function values are computed concurrently and stored in a buffer
+             *          before they are summed. The sum is computed by pairwise summation in a fixed order in either
+             *          case, so the result does not depend on the thread pool or its number of threads.
+             * @param count The number of abscissae.
+             * @param abscissa Invocable returning the abscissa with a given index in [0, count).
+             * @return The sum of the function values.
+             */
+            template<typename ABSCISSA_FN>
+            RESULT_T sumOf(uint64_t count, const ABSCISSA_FN& abscissa) const
+            {
+                if (!concurrent() || count < 2)
+                    return pairwiseSum(0, count, [&](uint64_t i) { return evaluate(abscissa(i)); });
+
+                std::vector< RESULT_T > values(count);
+                m_pool->parallel_for(count, [&](size_t i) { values[i] = evaluate(abscissa(i)); });
+                return pairwiseSum(0, count, [&](uint64_t i) { return values[i]; });
+            }
+
+            /**
+             * @brief Evaluates the function at several abscissae, concurrently if a thread pool is set.
+             * @param points The abscissae.
+             * @param values The function values; must be at least as large as `points`.
+             */
+            void evaluate(std::span< const ARG_T > points, std::span< RESULT_T > values) const
+            {
+                if (!concurrent() || points.size() < 2) {
+                    for (size_t i = 0; i < points.size(); ++i) values[i] = evaluate(points[i]);
+                    return;
+                }
+
+                m_pool->parallel_for(points.size(), [&](size_t i) { values[i] = evaluate(points[i]); });
+            }
+
+            /**
+             * @brief Lets the solver evaluate the function at the new abscissae of each iteration concurrently.
+             * @details All solvers support this: Trapezoid, Simpson and Romberg evaluate the new points of the grid
+             *          concurrently, the Gauss-Kronrod solvers the Kronrod nodes of both halves of the bisected
+             *          subinterval, and TanhSinh the nodes of the new level. The results do not depend on the thread
+             *          pool. As an iteration has few new abscissae for the Gauss-Kronrod solvers (30 or 42), this is
+             *          only worthwhile if the function is expensive to evaluate.
+             * @param pool The thread pool to use, or nullptr to evaluate serially. The pool must outlive the solver.
+             * @note The function must be safe to call concurrently.
+             */
+            void setExecutor(ThreadPool* pool) { m_pool = pool; }
+
+            /**
+             * @brief Checks whether the function is evaluated concurrently.
+             * @return true if a thread pool with more than one thread is set.
+             */
+            bool concurrent() const { return m_pool && m_pool->size() > 1; }
+
             /**
              * @brief Retrieves the current estimate of the integral.
              * @return The current integral estimate.
@@ -244,22 +335,6 @@ namespace nxx::integrate
      * @tparam FN The type of function to be integrated.
      * @tparam ARG_T The type of the argument for the function, defaulted to double.
      */
-
-    class MyFunctor2 {
-    public:
-        MyFunctor2(double lower_val, double h_val)
-            : n(1), lower(lower_val), h(h_val) {}
-
-        auto operator()() {
-            return lower + (2 * n++ - 1) * h;;
-        }
-
-    private:
-        int n; // Assuming 'n' is of type int. Adjust the type as necessary.
-        double lower; // Replace with the actual type of 'lower' if known.
-        double h; // Replace with the actual type if known.
-    };
-
     template<IsFloatInvocable FN, IsFloat ARG_T = double>
     class Trapezoid final : public detail::IntegrationBase< Trapezoid< FN, ARG_T >, FN, ARG_T >
     {
@@ -271,9 +346,7 @@ namespace nxx::integrate
 
         static const inline std::string SolverName = "Trapezoid"; /**< Name of the solver. */
 
-        int                     m_iter{ 1 };          /**< Iteration counter. */
-        uint64_t                m_midpointCount{ 1 }; // Initialize numOfMidpoints
-        std::vector< RESULT_T > m_midpoints;          // Member variable for midpoints
+        int m_iter{ 1 }; /**< Iteration counter. */
 
         /**
          * @brief Overloaded function call operator that performs a single iteration of the trapezoidal rule.
@@ -287,28 +360,12 @@ namespace nxx::integrate
             const auto& [lower, upper] = BASE::m_bounds;
 
             // Recalculate the interval based on the iteration number
-            uint64_t divisor = 1 << m_iter;
+            uint64_t divisor = uint64_t{ 1 } << m_iter;
             BASE::m_interval = (upper - lower) / divisor;
 
-            // Double the number of midpoints for this iteration
-            if (m_iter > 1) m_midpointCount *= 2;
-
-            auto f = MyFunctor2(lower, BASE::m_interval);
-
-            // Resize midPoints vector if necessary
-            m_midpoints.resize(m_midpointCount);
-            std::generate(m_midpoints.begin(),
-                          m_midpoints.end(),
-                          // [n = 1, lower, h = BASE::m_interval]() mutable { return lower + (2 * n++ - 1) * h; });
-                          f); // For some reason, the lambda solution doesn't work on clang-cl
-
-            // Calculate the sum of function values at the midpoints
-            const RESULT_T sum =
-                std::transform_reduce(m_midpoints.begin(),
-                                      m_midpoints.end(),
-                                      ARG_T(0.0),
-                                      std::plus(),
-                                      [&](RESULT_T x) { return BASE::evaluate(x); });
+            // Calculate the sum of function values at the 2^(m_iter - 1) midpoints
+            const uint64_t numMidpoints = uint64_t{ 1 } << (m_iter - 1);
+            const RESULT_T sum = BASE::sumOf(numMidpoints, [&](uint64_t k) { return lower + (2 * k + 1) * BASE::m_interval; });
 
             // Update the integral estimate
             BASE::m_estimate = BASE::m_estimate / 2 + BASE::m_interval * sum;
@@ -371,51 +428,58 @@ namespace nxx::integrate
     public:
         using BASE::BASE; /**< Inherits constructors from BracketingBase. */
         using RESULT_T = std::invoke_result_t< FN, ARG_T >;
-        using ARRAY_T = boost::multi_array< RESULT_T, 2 >; /**< Type for the Romberg integration table. */
 
         static const inline std::string SolverName = "Romberg"; /**< Name of the solver. */
 
-        int     m_iter{ 1 }; /**< Iteration counter. */
-        ARRAY_T R;           /**< Romberg integration table. */
+        /**
+         * @brief The maximum number of columns of the Romberg table. As iteration k evaluates the function at
+         *        2^(k-1) points, this limit is never reached in practice; beyond it, the order of the
+         *        extrapolation is no longer increased.
+         */
+        static constexpr int MaxDepth = 32;
+
+        using ROW_T = std::array< RESULT_T, MaxDepth >; /**< Type for a row of the Romberg integration table. */
+
+        int   m_iter{ 1 };  /**< Iteration counter. */
+        ROW_T m_previous{}; /**< The previous row of the Romberg table. */
+        ROW_T m_current{};  /**< The current row of the Romberg table. */
 
         /**
          * @brief Overloaded function call operator that performs a single iteration of Romberg integration.
          *
          * @details This method calculates the next approximation of the integral using the Romberg integration method.
-         *          It updates the Romberg table with new values computed in each iteration and uses these values to
-         *          extrapolate to higher order estimates of the integral.
+         *          It computes the next row of the Romberg table from the previous one, and uses these values to
+         *          extrapolate to higher order estimates of the integral. Only the last two rows of the table are
+         *          ever needed, so these are kept in fixed-size arrays, which are swapped in each iteration.
          */
         void operator()()
         {
-            using boost::extents;
-            R.resize(extents[m_iter + 1][m_iter + 1]);
-
             const auto& [lower, upper] = BASE::m_bounds;
 
-            // Initialize the first element with the basic trapezoidal rule
-            if (m_iter == 1) { R[0][0] = BASE::m_interval * (BASE::evaluate(lower) + BASE::evaluate(upper)) / 2; }
+            // Before the first iteration, the estimate of the base class is the basic trapezoidal rule
+            if (m_iter == 1) m_current[0] = BASE::m_estimate;
+            std::swap(m_previous, m_current);
 
             // Halve the step size for this iteration
-            uint64_t divisor = 1 << m_iter;
+            uint64_t divisor = uint64_t{ 1 } << m_iter;
             BASE::m_interval = (upper - lower) / divisor;
 
             // Trapezoidal rule: Calculate the sum of the function values at the midpoints
-            RESULT_T       sum          = 0.0;
-            const uint64_t numMidpoints = 1 << (m_iter - 1); // 2^(m_iter - 1) using bitwise shift
-            for (uint64_t k = 1; k <= numMidpoints; ++k)
-                sum += BASE::evaluate(lower + (2 * k - 1) * BASE::m_interval);
+            const uint64_t numMidpoints = uint64_t{ 1 } << (m_iter - 1); // 2^(m_iter - 1) using bitwise shift
+            const RESULT_T sum = BASE::sumOf(numMidpoints, [&](uint64_t k) { return lower + (2 * k + 1) * BASE::m_interval; });
 
-            // Update the Romberg table for the first column (trapezoidal rule)
-            R[m_iter][0] = R[m_iter - 1][0] / 2 + BASE::m_interval * sum;
+            // Update the first column of the Romberg table (trapezoidal rule)
+            m_current[0] = m_previous[0] / 2 + BASE::m_interval * sum;
 
             // Apply the Romberg integration formula
-            RESULT_T four_pow_j = 1; // Initial value for 4^j
-            for (int j = 1; j <= m_iter; ++j) {
+            const int columns    = std::min(m_iter, MaxDepth - 1);
+            RESULT_T  four_pow_j = 1; // Initial value for 4^j
+            for (int j = 1; j <= columns; ++j) {
                 four_pow_j *= 4; // Multiply by 4 at each step
-                R[m_iter][j] = R[m_iter][j - 1] + (R[m_iter][j - 1] - R[m_iter - 1][j - 1]) / (four_pow_j - 1);
+                m_current[j] = m_current[j - 1] + (m_current[j - 1] - m_previous[j - 1]) / (four_pow_j - 1);
             }
 
-            BASE::m_estimate = R[m_iter][m_iter];
+            BASE::m_estimate = m_current[columns];
             m_iter++;
         }
     };
@@ -455,6 +519,11 @@ namespace nxx::integrate
      *          It is derived from IntegrationBase and overrides the operator() to implement
      *          the specific logic for Simpson's rule integration.
      *
+     *          The Simpson estimates are computed from the sequence of trapezoid estimates, as
+     *          S_k = (4 * T_k - T_{k-1}) / 3, where T_k uses 2^k intervals. Each iteration halves the
+     *          step size, and evaluates the function only at the 2^(k-1) new midpoints; all previous
+     *          function evaluations are carried over in T_{k-1}, and no abscissas are stored.
+     *
      *          The Simpson class is designed for use in single-threaded environments.
      *          It is not thread-safe and should not be accessed concurrently from multiple
      *          threads. If multithreaded usage is required, it is the responsibility of the
@@ -468,22 +537,6 @@ namespace nxx::integrate
      * @tparam FN The type of function to be integrated.
      * @tparam ARG_T The type of the argument for the function, defaulted to double.
      */
-
-    class MyFunctor {
-    public:
-        MyFunctor(double lower_val, double h_val)
-            : n(0), lower(lower_val), h(h_val) {}
-
-        auto operator()() {
-            return lower + n++ * h;
-        }
-
-    private:
-        int n; // Assuming 'n' is of type int. Adjust the type as necessary.
-        double lower; // Replace with the actual type of 'lower' if known.
-        double h; // Replace with the actual type if known.
-    };
-
     template<IsFloatInvocable FN, IsFloat ARG_T = double>
     class Simpson final : public detail::IntegrationBase< Simpson< FN, ARG_T >, FN, ARG_T >
     {
@@ -495,46 +548,36 @@ namespace nxx::integrate
 
         static const inline std::string SolverName = "Simpson"; /**< Name of the solver. */
 
-        int                     m_iter{ 1 };
-        int                     numOfIntervals{ 1 }; // Initialize numOfIntervals
-        std::vector< RESULT_T > points;              // Member variable for points
+        int      m_iter{ 1 };   /**< Iteration counter. */
+        RESULT_T m_trapezoid{}; /**< The trapezoid estimate of the previous iteration, T_{k-1}. */
 
         /**
          * @brief Overloaded function call operator that performs a single iteration of Simpson's rule.
          *
          * @details This method calculates the next approximation of the integral using Simpson's rule.
-         *          It divides the integration interval into smaller sub-intervals and calculates the area
-         *          under the curve of the function using Simpson's rule.
+         *          The trapezoid estimate is refined by adding the function values at the midpoints of the
+         *          current intervals, and the Simpson estimate is obtained by Richardson extrapolation of
+         *          the two latest trapezoid estimates.
          */
         void operator()()
         {
             const auto& [lower, upper] = BASE::m_bounds;
 
+            // Before the first iteration, the estimate of the base class is the trapezoid estimate T_0.
+            if (m_iter == 1) m_trapezoid = BASE::m_estimate;
+
             // Halve the step size for this iteration
-            uint64_t divisor = 1 << m_iter;
+            uint64_t divisor = uint64_t{ 1 } << m_iter;
             BASE::m_interval = (upper - lower) / divisor;
 
-            // Double the number of intervals using arithmetic operation
-            numOfIntervals *= 2;
+            // Calculate the sum of the function values at the new midpoints only
+            const uint64_t numMidpoints = uint64_t{ 1 } << (m_iter - 1);
+            const RESULT_T sum = BASE::sumOf(numMidpoints, [&](uint64_t k) { return lower + (2 * k + 1) * BASE::m_interval; });
 
-            // Calculate the total number of points
-            int numOfPoints = numOfIntervals + 1;
-
-            auto f = MyFunctor(lower, BASE::m_interval);
-
-            // Resize points vector if necessary
-            points.resize(numOfPoints);
-            std::generate(points.begin(),
-                          points.end(),
-                          // [n = 0, lower, h = BASE::m_interval]() mutable { return lower + n++ * h; });
-                                f); // For some reason, the lambda solution doesn't work on clang-cl
-
-            // Calculate the sum of function values at the points, with alternating coefficients 4 and 2
-            RESULT_T sum = 0.0;
-            for (size_t i = 1; i < numOfPoints - 1; ++i) { sum += BASE::evaluate(points[i]) * (i % 2 == 0 ? 2 : 4); }
-
-            // Update the integral estimate
-            BASE::m_estimate = (BASE::m_interval / 3) * (BASE::evaluate(lower) + BASE::evaluate(upper) + sum);
+            // Refine the trapezoid estimate, and extrapolate to the Simpson estimate
+            const RESULT_T trapezoid = m_trapezoid / 2 + BASE::m_interval * sum;
+            BASE::m_estimate         = (4 * trapezoid - m_trapezoid) / 3;
+            m_trapezoid              = trapezoid;
             m_iter++;
         }
     };
@@ -552,6 +595,661 @@ namespace nxx::integrate
     Simpson(FN, std::initializer_list< ARG_T >) -> Simpson< FN, ARG_T >;
 
 
+    // =================================================================================================================
+    //   ,ad8888ba,                                                   88      a8P                                                                          88
+    //  d8"'    `"8b                                                  88    ,88'                                                                           88
+    // d8'                                                            88  ,88"                                                                             88
+    // 88              ,adPPYYba,  88       88  ,adPPYba,  ,adPPYba,  88,d88'       8b,dPPYba,   ,adPPYba,   8b,dPPYba,   8b,dPPYba,   ,adPPYba,    ,adPPYb,88
+    // 88      88888   ""     `Y8  88       88  I8[    ""  I8[    ""  8888"88,      88P'   "Y8  a8"     "8a  88P'   `"8a  88P'   "Y8  a8"     "8a  a8"    `Y88
+    // Y8,        88   ,adPPPPP88  88       88   `"Y8ba,    `"Y8ba,   88P   Y8b     88          8b       d8  88       88  88          8b       d8  8b       88
+    //  Y8a.    .a88   88,    ,88  "8a,   ,a88  aa    ]8I  aa    ]8I  88     "88,   88          "8a,   ,a8"  88       88  88          "8a,   ,a8"  "8a,   ,d88
+    //   `"Y88888P"    `"8bbdP"Y8   `"YbbdP'Y8  `"YbbdP"'  `"YbbdP"'  88       Y8b  88           `"YbbdP"'   88       88  88           `"YbbdP"'    `"8bbdP"Y8
+    // =================================================================================================================
+
+    namespace detail
+    {
+        /**
+         * @brief Nodes and weights of the 15-point Kronrod rule, and the embedded 7-point Gauss rule, on [-1, 1].
+         *
+         * @details The nodes are the non-negative Kronrod abscissas in decreasing order, ending with the center.
+         *          The Gauss nodes are the Kronrod nodes with odd indices. The values are those of QUADPACK (qk15).
+         */
+        struct GaussKronrod15Rule
+        {
+            static constexpr std::array< long double, 8 > Nodes{
+                0.991455371120812639206854697526329L, 0.949107912342758524526189684047851L,
+                0.864864423359769072789712788640926L, 0.741531185599394439863864773280788L,
+                0.586087235467691130294144845693013L, 0.405845151377397166906606412076961L,
+                0.207784955007898467600689403773245L, 0.000000000000000000000000000000000L
+            }; /**< The Kronrod nodes. */
+
+            static constexpr std::array< long double, 8 > KronrodWeights{
+                0.022935322010529224963732008058970L, 0.063092092629978553290700663189204L,
+                0.104790010322250183839876322541518L, 0.140653259715525918745189590510238L,
+                0.169004726639267902826583426598550L, 0.190350578064785409913256402421014L,
+                0.204432940075298892414161999234649L, 0.209482141084727828012999174891714L
+            }; /**< The Kronrod weights. */
+
+            static constexpr std::array< long double, 4 > GaussWeights{
+                0.129484966168869693270611432679082L, 0.279705391489276667901467771423780L,
+                0.381830050505118944950369775488975L, 0.417959183673469387755102040816327L
+            }; /**< The Gauss weights, for the Kronrod nodes with odd indices. */
+        };
+
+        /**
+         * @brief Nodes and weights of the 21-point Kronrod rule, and the embedded 10-point Gauss rule, on [-1, 1].
+         *
+         * @details The layout is the same as for GaussKronrod15Rule. The values are those of QUADPACK (qk21).
+         */
+        struct GaussKronrod21Rule
+        {
+            static constexpr std::array< long double, 11 > Nodes{
+                0.995657163025808080735527280689003L, 0.973906528517171720077964012084452L,
+                0.930157491355708226001207180059508L, 0.865063366688984510732096688423493L,
+                0.780817726586416897063717578345042L, 0.679409568299024406234327365114874L,
+                0.562757134668604683339000099272694L, 0.433395394129247190799265943165784L,
+                0.294392862701460198131126603103866L, 0.148874338981631210884826001129720L,
+                0.000000000000000000000000000000000L
+            }; /**< The Kronrod nodes. */
+
+            static constexpr std::array< long double, 11 > KronrodWeights{
+                0.011694638867371874278064396062192L, 0.032558162307964727478818972459390L,
+                0.054755896574351996031381300244580L, 0.075039674810919952767043140916190L,
+                0.093125454583697605535065465083366L, 0.109387158802297641899210590325805L,
+                0.123491976262065851077982343195325L, 0.134709217311473325928054001771707L,
+                0.142775938577060080797094273138717L, 0.147739104901338491374841515972068L,
+                0.149445554002916905664936468389821L
+            }; /**< The Kronrod weights. */
+
+            static constexpr std::array< long double, 5 > GaussWeights{
+                0.066671344308688137593568809893332L, 0.149451349150580593145776339657697L,
+                0.219086362515982043995534934228163L, 0.269266719309996355091226921569469L,
+                0.295524224714752870173892994651338L
+            }; /**< The Gauss weights, for the Kronrod nodes with odd indices. */
+        };
+
+        /**
+         * @class AdaptiveGaussKronrod
+         * @brief Globally adaptive Gauss-Kronrod quadrature (QUADPACK's QAG), shared by the Gauss-Kronrod solvers.
+         *
+         * @details The subintervals are kept in a max-heap, keyed by their error estimates. Each refinement bisects
+         *          the subinterval with the largest error estimate, and applies the Kronrod rule to both halves.
+         *          The heap is allocated once, for a number of subintervals that suffices for most integrands.
+         *
+         * @tparam RULE The Gauss-Kronrod rule, i.e. GaussKronrod15Rule or GaussKronrod21Rule.
+         * @tparam ARG_T The type of the argument for the function.
+         * @tparam RESULT_T The type of the return value of the function.
+         */
+        template<typename RULE, typename ARG_T, typename RESULT_T>
+        class AdaptiveGaussKronrod
+        {
+        public:
+            static constexpr size_t InitialCapacity = 128;                       /**< The number of subintervals allocated for initially. */
+            static constexpr size_t Points          = 2 * RULE::Nodes.size() - 1; /**< The number of nodes per subinterval. */
+
+            /**
+             * @brief Refines the estimate of the integral; the first call applies the rule to the whole interval.
+             * @details The nodes of both halves of the bisected subinterval are evaluated in a single call, so that
+             *          the evaluator can compute the function values concurrently.
+             * @param evaluate Invocable taking a span of abscissae and a span for the function values at these.
+             * @param bounds The bounds of integration.
+             */
+            template<typename EVALUATOR_T, typename BOUNDS_T>
+            void refine(const EVALUATOR_T& evaluate, const BOUNDS_T& bounds)
+            {
+                std::array< ARG_T, 2 * Points >    points;
+                std::array< RESULT_T, 2 * Points > values;
+
+                if (m_segments.empty()) {
+                    m_segments.reserve(InitialCapacity);
+                    abscissae(bounds.first, bounds.second, points.data());
+                    evaluate(std::span(points).first(Points), std::span(values).first(Points));
+                    m_segments.push_back(apply(bounds.first, bounds.second, values.data()));
+                }
+                else {
+                    std::pop_heap(m_segments.begin(), m_segments.end(), compare);
+                    const Segment worst  = m_segments.back();
+                    const ARG_T   center = (worst.lower + worst.upper) / 2;
+                    abscissae(worst.lower, center, points.data());
+                    abscissae(center, worst.upper, points.data() + Points);
+                    evaluate(std::span(points), std::span(values));
+                    m_segments.back() = apply(worst.lower, center, values.data());
+                    std::push_heap(m_segments.begin(), m_segments.end(), compare);
+                    m_segments.push_back(apply(center, worst.upper, values.data() + Points));
+                    std::push_heap(m_segments.begin(), m_segments.end(), compare);
+                }
+
+                // The totals are summed afresh, rather than updated, to avoid the accumulation of roundoff errors.
+                m_value = 0.0;
+                m_error = 0.0;
+                for (const auto& segment : m_segments) {
+                    m_value += segment.value;
+                    m_error += segment.error;
+                }
+            }
+
+            /**
+             * @brief Retrieves the current estimate of the integral.
+             * @return The sum of the estimates over all subintervals.
+             */
+            RESULT_T value() const { return m_value; }
+
+            /**
+             * @brief Retrieves the estimated absolute error of the current estimate.
+             * @return The sum of the error estimates over all subintervals, or infinity before the first refinement.
+             */
+            RESULT_T error() const { return m_segments.empty() ? std::numeric_limits< RESULT_T >::infinity() : m_error; }
+
+            /**
+             * @brief Retrieves the number of subintervals.
+             * @return The number of subintervals.
+             */
+            size_t size() const { return m_segments.size(); }
+
+        private:
+            /**
+             * @brief A subinterval, with the estimate of the integral over it and the estimated error.
+             */
+            struct Segment
+            {
+                ARG_T    lower; /**< The lower bound of the subinterval. */
+                ARG_T    upper; /**< The upper bound of the subinterval. */
+                RESULT_T value; /**< The Kronrod estimate of the integral over the subinterval. */
+                RESULT_T error; /**< The estimated absolute error. */
+            };
+
+            std::vector< Segment > m_segments{}; /**< The subintervals, arranged as a max-heap on the error estimates. */
+            RESULT_T               m_value{};    /**< The current estimate of the integral. */
+            RESULT_T               m_error{};    /**< The estimated absolute error of the current estimate. */
+
+            /**
+             * @brief Orders the subintervals by their error estimates, such that the worst one is at the top of the heap.
+             */
+            static bool compare(const Segment& lhs, const Segment& rhs) { return lhs.error < rhs.error; }
+
+            /**
+             * @brief Computes the Kronrod nodes of a subinterval: the center, followed by the nodes left of the
+             *        center, and then the nodes right of the center, each from the outermost one inwards.
+             * @param lower The lower bound of the subinterval.
+             * @param upper The upper bound of the subinterval.
+             * @param points The output; must hold Points abscissae.
+             */
+            static void abscissae(ARG_T lower, ARG_T upper, ARG_T* points)
+            {
+                constexpr size_t last = RULE::Nodes.size() - 1;
+
+                const ARG_T center   = (lower + upper) / 2;
+                const ARG_T halfSize = (upper - lower) / 2;
+
+                points[0] = center;
+                for (size_t j = 0; j < last; ++j) {
+                    const ARG_T offset   = halfSize * static_cast< ARG_T >(RULE::Nodes[j]);
+                    points[1 + j]        = center - offset;
+                    points[1 + last + j] = center + offset;
+                }
+            }
+
+            /**
+             * @brief Applies the Gauss-Kronrod rule to a subinterval.
+             *
+             * @details The error estimate is that of QUADPACK: the difference between the Kronrod and the Gauss
+             *          estimates is scaled by (200 * |K - G| / I_asc)^1.5, where I_asc is the integral of |f - mean|.
+             *          This recognizes the much higher accuracy of the Kronrod estimate for smooth integrands.
+             *          As in QUADPACK, the estimate is bounded below by 50 * epsilon * I_abs, where I_abs is the integral
+             *          of |f|, so that the refinement does not chase tolerances below the roundoff level.
+             *
+             * @param lower The lower bound of the subinterval.
+             * @param upper The upper bound of the subinterval.
+             * @param values The function values at the nodes, in the order of abscissae().
+             * @return The subinterval, with the estimate of the integral and the estimated error.
+             */
+            static Segment apply(ARG_T lower, ARG_T upper, const RESULT_T* values)
+            {
+                using std::abs;
+                using std::max;
+                using std::min;
+                using std::pow;
+
+                constexpr size_t last = RULE::Nodes.size() - 1;
+
+                const ARG_T     halfSize = (upper - lower) / 2;
+                const RESULT_T  fcenter  = values[0];
+                const RESULT_T* fminus   = values + 1;
+                const RESULT_T* fplus    = values + 1 + last;
+
+                RESULT_T kronrod  = fcenter * static_cast< RESULT_T >(RULE::KronrodWeights[last]);
+                RESULT_T gauss    = 0.0;
+                RESULT_T absolute = abs(kronrod);
+                if constexpr (last % 2 == 1) gauss = fcenter * static_cast< RESULT_T >(RULE::GaussWeights[last / 2]);
+
+                for (size_t j = 0; j < last; ++j) {
+                    const RESULT_T weight = static_cast< RESULT_T >(RULE::KronrodWeights[j]);
+                    kronrod += weight * (fminus[j] + fplus[j]);
+                    absolute += weight * (abs(fminus[j]) + abs(fplus[j]));
+                    if (j % 2 == 1) gauss += static_cast< RESULT_T >(RULE::GaussWeights[j / 2]) * (fminus[j] + fplus[j]);
+                }
+
+                const RESULT_T mean       = kronrod / 2;
+                RESULT_T       asymmetric = static_cast< RESULT_T >(RULE::KronrodWeights[last]) * abs(fcenter - mean);
+                for (size_t j = 0; j < last; ++j)
+                    asymmetric += static_cast< RESULT_T >(RULE::KronrodWeights[j]) * (abs(fminus[j] - mean) + abs(fplus[j] - mean));
+
+                const RESULT_T scale = abs(halfSize);
+                RESULT_T       error = abs((kronrod - gauss) * halfSize);
+                asymmetric *= scale;
+                absolute *= scale;
+                if (asymmetric != 0.0 && error != 0.0) error = asymmetric * min(RESULT_T(1.0), pow(200 * error / asymmetric, RESULT_T(1.5)));
+
+                constexpr RESULT_T epsilon = std::numeric_limits< RESULT_T >::epsilon();
+                if (absolute > std::numeric_limits< RESULT_T >::min() / (50 * epsilon)) error = max(50 * epsilon * absolute, error);
+
+                return Segment{ lower, upper, kronrod * halfSize, error };
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @class GaussKronrod
+     * @brief Implementation of globally adaptive numerical integration using the 15-point Gauss-Kronrod rule.
+     *
+     * @details This class implements globally adaptive integration, as QUADPACK's QAG routine. The first
+     *          iteration applies the 15-point Kronrod rule (with the embedded 7-point Gauss rule for the error
+     *          estimate) to the whole interval, and each subsequent iteration bisects the subinterval with the
+     *          largest error estimate. Hence, the function evaluations are concentrated where the integrand is
+     *          difficult, e.g. around sharp peaks, instead of being spread uniformly over the interval.
+     *
+     *          As opposed to the other solvers, an estimate of the absolute error is available from the error()
+     *          function, which is used by the integrate function for the convergence check. Note that each
+     *          iteration costs 30 function evaluations, and only refines a single subinterval; for difficult
+     *          integrands, the maximum number of iterations should be raised accordingly.
+     *
+     *          The GaussKronrod class is designed for use in single-threaded environments.
+     *          It is not thread-safe and should not be accessed concurrently from multiple
+     *          threads. If multithreaded usage is required, it is the responsibility of the
+     *          user to ensure proper synchronization mechanisms are in place to prevent
+     *          concurrent access and modification.
+     *
+     * @tparam FN The type of function to be integrated.
+     * @tparam ARG_T The type of the argument for the function, defaulted to double.
+     */
+    template<IsFloatInvocable FN, IsFloat ARG_T = double>
+    class GaussKronrod final : public detail::IntegrationBase< GaussKronrod< FN, ARG_T >, FN, ARG_T >
+    {
+        using BASE = detail::IntegrationBase< GaussKronrod< FN, ARG_T >, FN, ARG_T >; /**< Base class alias for readability. */
+
+    public:
+        using BASE::BASE; /**< Inherits constructors from IntegrationBase. */
+        using RESULT_T = std::invoke_result_t< FN, ARG_T >;
+
+        static const inline std::string SolverName = "GaussKronrod"; /**< Name of the solver. */
+        static constexpr bool           EvaluatesEndpoints = false;          /**< The Kronrod nodes are interior. */
+
+        /**
+         * @brief Overloaded function call operator that performs a single iteration of the adaptive integration.
+         */
+        void operator()()
+        {
+            m_quadrature.refine([this](auto points, auto values) { BASE::evaluate(points, values); }, BASE::m_bounds);
+            BASE::m_estimate = m_quadrature.value();
+        }
+
+        /**
+         * @brief Retrieves the estimated absolute error of the current estimate.
+         * @return The estimated absolute error, or infinity before the first iteration.
+         */
+        RESULT_T error() const { return m_quadrature.error(); }
+
+    private:
+        detail::AdaptiveGaussKronrod< detail::GaussKronrod15Rule, ARG_T, RESULT_T > m_quadrature; /**< The subintervals. */
+    };
+
+    /**
+     * @brief Deduction guides for GaussKronrod class.
+     * Allows the type of GaussKronrod class to be deduced from the constructor parameters.
+     */
+    template<typename FN, typename BOUNDS_T>
+        requires IsFloatInvocable< FN > && IsFloatStruct< BOUNDS_T >
+    GaussKronrod(FN, BOUNDS_T) -> GaussKronrod< FN, StructCommonType_t< BOUNDS_T > >;
+
+    template<typename FN, typename ARG_T>
+        requires IsFloatInvocable< FN > && IsFloat< ARG_T >
+    GaussKronrod(FN, std::initializer_list< ARG_T >) -> GaussKronrod< FN, ARG_T >;
+
+    /**
+     * @class GaussKronrod21
+     * @brief Implementation of globally adaptive numerical integration using the 21-point Gauss-Kronrod rule.
+     *
+     * @details This class works as the GaussKronrod class, but uses the 21-point Kronrod rule with the embedded
+     *          10-point Gauss rule, i.e. 42 function evaluations per iteration. The higher order pays off for
+     *          smooth integrands, where fewer bisections are needed.
+     *
+     * @tparam FN The type of function to be integrated.
+     * @tparam ARG_T The type of the argument for the function, defaulted to double.
+     */
+    template<IsFloatInvocable FN, IsFloat ARG_T = double>
+    class GaussKronrod21 final : public detail::IntegrationBase< GaussKronrod21< FN, ARG_T >, FN, ARG_T >
+    {
+        using BASE = detail::IntegrationBase< GaussKronrod21< FN, ARG_T >, FN, ARG_T >; /**< Base class alias for readability. */
+
+    public:
+        using BASE::BASE; /**< Inherits constructors from IntegrationBase. */
+        using RESULT_T = std::invoke_result_t< FN, ARG_T >;
+
+        static const inline std::string SolverName = "GaussKronrod21"; /**< Name of the solver. */
+        static constexpr bool           EvaluatesEndpoints = false;          /**< The Kronrod nodes are interior. */
+
+        /**
+         * @brief Overloaded function call operator that performs a single iteration of the adaptive integration.
+         */
+        void operator()()
+        {
+            m_quadrature.refine([this](auto points, auto values) { BASE::evaluate(points, values); }, BASE::m_bounds);
+            BASE::m_estimate = m_quadrature.value();
+        }
+
+        /**
+         * @brief Retrieves the estimated absolute error of the current estimate.
+         * @return The estimated absolute error, or infinity before the first iteration.
+         */
+        RESULT_T error() const { return m_quadrature.error(); }
+
+    private:
+        detail::AdaptiveGaussKronrod< detail::GaussKronrod21Rule, ARG_T, RESULT_T > m_quadrature; /**< The subintervals. */
+    };
+
+    /**
+     * @brief Deduction guides for GaussKronrod21 class.
+     * Allows the type of GaussKronrod21 class to be deduced from the constructor parameters.
+     */
+    template<typename FN, typename BOUNDS_T>
+        requires IsFloatInvocable< FN > && IsFloatStruct< BOUNDS_T >
+    GaussKronrod21(FN, BOUNDS_T) -> GaussKronrod21< FN, StructCommonType_t< BOUNDS_T > >;
+
+    template<typename FN, typename ARG_T>
+        requires IsFloatInvocable< FN > && IsFloat< ARG_T >
+    GaussKronrod21(FN, std::initializer_list< ARG_T >) -> GaussKronrod21< FN, ARG_T >;
+
+
+    // =================================================================================================================
+    // 888888888888                           88             ad88888ba    88               88
+    //      88                                88            d8"     "8b   ""               88
+    //      88                                88            Y8,                            88
+    //      88       ,adPPYYba,  8b,dPPYba,   88,dPPYba,    `Y8aaaaa,     88  8b,dPPYba,   88,dPPYba,
+    //      88       ""     `Y8  88P'   `"8a  88P'    "8a     `"""""8b,   88  88P'   `"8a  88P'    "8a
+    //      88       ,adPPPPP88  88       88  88       88           `8b   88  88       88  88       88
+    //      88       88,    ,88  88       88  88       88   Y8a     a8P   88  88       88  88       88
+    //      88       `"8bbdP"Y8  88       88  88       88    "Y88888P"    88  88       88  88       88
+    // =================================================================================================================
+
+    namespace detail
+    {
+        /**
+         * @brief Returns pi / 2 in the given type; for non-standard types, pi is converted from double.
+         */
+        template<typename T>
+        T halfPiOf()
+        {
+            if constexpr (std::floating_point< T >)
+                return std::numbers::pi_v< T > / 2;
+            else
+                return T(std::numbers::pi) / 2;
+        }
+
+        /**
+         * @class TanhSinhTable
+         * @brief Abscissas and weights of the tanh-sinh (double exponential) quadrature rule on [-1, 1].
+         *
+         * @details The substitution x = tanh(pi/2 * sinh(t)) maps [-1, 1] to the real line, and the transformed
+         *          integrand decays double exponentially, such that the trapezoidal rule with step size h converges
+         *          very fast, even for integrands with singularities at the endpoints. Level 0 has the nodes t = 1, 2,
+         *          ..., and level k the nodes at the odd multiples of 2^-k; the node t = 0 is handled separately.
+         *          Within each level, the nodes are stored in order of increasing t, i.e. from the center towards the
+         *          endpoints, so that the tail of a level can be skipped.
+         *
+         *          Instead of the abscissas, their distances to the endpoints, 1 - |x| = exp(-u) / cosh(u) with
+         *          u = pi/2 * sinh(t), are stored, which retain full relative precision close to the endpoints.
+         *          The nodes are truncated where the distance underflows.
+         *
+         *          The table is computed once per type, on first use, and shared by all integrations.
+         *
+         * @tparam T The floating point type of the table.
+         */
+        template<typename T>
+        class TanhSinhTable
+        {
+        public:
+            static constexpr int MaxLevel = 10; /**< The number of levels, after level 0. */
+
+            /**
+             * @brief Retrieves the table for the type T, computing it on first use.
+             * @return A reference to the shared table.
+             */
+            static const TanhSinhTable& instance()
+            {
+                static const TanhSinhTable table;
+                return table;
+            }
+
+            /**
+             * @brief Retrieves the values of t of the nodes at a given level.
+             */
+            const std::vector< T >& nodes(int level) const { return m_nodes[level]; }
+
+            /**
+             * @brief Retrieves the distances 1 - |x| of the nodes at a given level to the endpoints.
+             */
+            const std::vector< T >& complements(int level) const { return m_complements[level]; }
+
+            /**
+             * @brief Retrieves the weights of the nodes at a given level.
+             */
+            const std::vector< T >& weights(int level) const { return m_weights[level]; }
+
+        private:
+            std::array< std::vector< T >, MaxLevel + 1 > m_nodes{};       /**< The values of t, per level. */
+            std::array< std::vector< T >, MaxLevel + 1 > m_complements{}; /**< The distances to the endpoints, per level. */
+            std::array< std::vector< T >, MaxLevel + 1 > m_weights{};     /**< The weights, per level. */
+
+            /**
+             * @brief Computes the table.
+             */
+            TanhSinhTable()
+            {
+                using std::cosh;
+                using std::exp;
+                using std::sinh;
+
+                const T halfPi = halfPiOf< T >();
+                for (int level = 0; level <= MaxLevel; ++level) {
+                    const T step  = level == 0 ? T(1.0) : T(1.0) / T(1 << level);
+                    const T first = level == 0 ? T(1.0) : step;
+                    for (T t = first;; t += (level == 0 ? step : 2 * step)) {
+                        const T u          = halfPi * sinh(t);
+                        const T complement = exp(-u) / cosh(u);
+                        const T weight     = halfPi * cosh(t) / (cosh(u) * cosh(u));
+                        if (!(complement >= std::numeric_limits< T >::min()) || !(weight >= std::numeric_limits< T >::min())) break;
+                        m_nodes[level].push_back(t);
+                        m_complements[level].push_back(complement);
+                        m_weights[level].push_back(weight);
+                    }
+                }
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @class TanhSinh
+     * @brief Implementation of numerical integration using tanh-sinh (double exponential) quadrature.
+     *
+     * @details This class implements the tanh-sinh quadrature, which is well suited for integrands with algebraic
+     *          or logarithmic singularities at the endpoints, such as 1/sqrt(x) or log(x) on [0, 1]. The function is
+     *          never evaluated at the endpoints. Each iteration halves the step size of the underlying trapezoidal
+     *          rule, and evaluates the function only at the new nodes, i.e. all previous evaluations are reused.
+     *          The nodes and weights are taken from a table shared by all instances (see detail::TanhSinhTable).
+     *
+     *          The first iteration also determines, for each end of the interval, how far out the terms of the
+     *          sum are significant; nodes further out are skipped at all subsequent levels. Likewise, nodes that
+     *          coincide with the endpoint in floating point, or where the function is not finite, end the tail.
+     *
+     *          The TanhSinh class is designed for use in single-threaded environments.
+     *          It is not thread-safe and should not be accessed concurrently from multiple
+     *          threads. If multithreaded usage is required, it is the responsibility of the
+     *          user to ensure proper synchronization mechanisms are in place to prevent
+     *          concurrent access and modification.
+     *
+     * @tparam FN The type of function to be integrated.
+     * @tparam ARG_T The type of the argument for the function, defaulted to double.
+     */
+    template<IsFloatInvocable FN, IsFloat ARG_T = double>
+    class TanhSinh final : public detail::IntegrationBase< TanhSinh< FN, ARG_T >, FN, ARG_T >
+    {
+        using BASE  = detail::IntegrationBase< TanhSinh< FN, ARG_T >, FN, ARG_T >; /**< Base class alias for readability. */
+        using TABLE = detail::TanhSinhTable< ARG_T >;                                /**< The shared table of nodes. */
+
+    public:
+        using BASE::BASE; /**< Inherits constructors from IntegrationBase. */
+        using RESULT_T = std::invoke_result_t< FN, ARG_T >;
+
+        static const inline std::string SolverName = "TanhSinh"; /**< Name of the solver. */
+        static constexpr bool           EvaluatesEndpoints = false;      /**< The endpoints are never evaluated. */
+
+        /**
+         * @brief Overloaded function call operator that performs a single iteration of tanh-sinh quadrature.
+         *
+         * @details The first iteration evaluates the center and the nodes of level 0; each subsequent iteration
+         *          adds the nodes of the next level, halving the step size. Beyond the last level of the table,
+         *          the estimate and the error estimate are no longer refined.
+         */
+        void operator()()
+        {
+            using std::abs;
+            using std::isfinite;
+
+            if (m_level > TABLE::MaxLevel) return;
+
+            const auto& [lower, upper] = BASE::m_bounds;
+            const auto& table          = TABLE::instance();
+            const ARG_T halfSize       = (upper - lower) / 2;
+
+            const auto& nodes       = table.nodes(m_level);
+            const auto& complements = table.complements(m_level);
+            const auto& weights     = table.weights(m_level);
+
+            auto abscissa = [&](ARG_T endpoint, ARG_T direction, size_t i) { return endpoint + direction * halfSize * complements[i]; };
+
+            // Counts the nodes of one side of the interval, from the center outwards, that are within the tail limit
+            // and do not coincide with the endpoint.
+            auto countOf = [&](ARG_T endpoint, ARG_T direction, ARG_T limit) {
+                size_t count = 0;
+                while (count < nodes.size() && nodes[count] <= limit && abscissa(endpoint, direction, count) != endpoint) ++count;
+                return count;
+            };
+
+            // Adds the terms of one side of the interval, from the center outwards, until the first non-finite value.
+            // Returns the partial sum and the tail limit to use on that side for the following levels.
+            auto accumulate = [&](size_t count, const auto& valueOf) {
+                RESULT_T                   sum     = 0.0;
+                RESULT_T                   norm    = 0.0;
+                ARG_T                      outmost = 0.0;
+                std::array< RESULT_T, 16 > terms{};
+                size_t                     i = 0;
+                for (; i < count; ++i) {
+                    const RESULT_T value = valueOf(i);
+                    if (!isfinite(value)) break;
+                    const RESULT_T term = weights[i] * value;
+                    sum += term;
+                    if (m_level == 0 && i < terms.size()) {
+                        terms[i] = abs(term);
+                        norm += terms[i];
+                    }
+                    outmost = nodes[i];
+                }
+
+                // On the first level, the tail is cut after the last term that is significant relative to the sum.
+                if (m_level == 0) {
+                    outmost = 0.0;
+                    for (size_t j = 0; j < std::min(i, terms.size()); ++j)
+                        if (terms[j] > std::numeric_limits< RESULT_T >::epsilon() * norm) outmost = nodes[j];
+                    outmost += 1;
+                }
+                return std::pair{ sum, outmost };
+            };
+
+            if (m_level == 0) {
+                m_sum        = BASE::evaluate((lower + upper) / 2) * detail::halfPiOf< RESULT_T >();
+                m_leftLimit  = std::numeric_limits< ARG_T >::infinity();
+                m_rightLimit = std::numeric_limits< ARG_T >::infinity();
+            }
+
+            const size_t leftCount  = countOf(lower, ARG_T(1.0), m_leftLimit);
+            const size_t rightCount = countOf(upper, ARG_T(-1.0), m_rightLimit);
+
+            // With a thread pool, the nodes of both sides are evaluated up front, including any beyond a non-finite
+            // value. The terms are added in the same order either way, so the result does not depend on the pool.
+            std::vector< RESULT_T > values;
+            if (BASE::concurrent()) {
+                std::vector< ARG_T > points(leftCount + rightCount);
+                for (size_t i = 0; i < leftCount; ++i) points[i] = abscissa(lower, ARG_T(1.0), i);
+                for (size_t i = 0; i < rightCount; ++i) points[leftCount + i] = abscissa(upper, ARG_T(-1.0), i);
+                values.resize(points.size());
+                BASE::evaluate(points, values);
+            }
+
+            auto valueOf = [&](ARG_T endpoint, ARG_T direction, size_t offset) {
+                return [&, endpoint, direction, offset](size_t i) {
+                    return values.empty() ? BASE::evaluate(abscissa(endpoint, direction, i)) : values[offset + i];
+                };
+            };
+
+            const auto [left, leftLimit]   = accumulate(leftCount, valueOf(lower, ARG_T(1.0), 0));
+            const auto [right, rightLimit] = accumulate(rightCount, valueOf(upper, ARG_T(-1.0), leftCount));
+            m_sum += left + right;
+            if (m_level == 0) {
+                m_leftLimit  = leftLimit;
+                m_rightLimit = rightLimit;
+            }
+
+            const ARG_T    step     = m_level == 0 ? ARG_T(1.0) : ARG_T(1.0) / ARG_T(uint64_t{ 1 } << m_level);
+            const RESULT_T previous = BASE::m_estimate;
+            BASE::m_interval        = step;
+            BASE::m_estimate        = m_sum * step * halfSize;
+            if (m_level > 0) m_error = abs(BASE::m_estimate - previous);
+            m_level++;
+        }
+
+        /**
+         * @brief Retrieves the estimated absolute error of the current estimate.
+         *
+         * @details The error is estimated by the difference between the two latest estimates. As the error
+         *          roughly squares with each level, this is conservative. Once the table is exhausted, the
+         *          error estimate is not reduced any further, so a tolerance that cannot be met is reported
+         *          as such, rather than as convergence.
+         *
+         * @return The estimated absolute error, or infinity before the second iteration.
+         */
+        RESULT_T error() const { return m_error; }
+
+    private:
+        int      m_level{ 0 };                                          /**< The next level of the table to add. */
+        RESULT_T m_sum{};                                               /**< The weighted sum of the function values so far. */
+        ARG_T    m_leftLimit{};                                         /**< The largest t of the nodes used at the lower end. */
+        ARG_T    m_rightLimit{};                                        /**< The largest t of the nodes used at the upper end. */
+        RESULT_T m_error{ std::numeric_limits< RESULT_T >::infinity() }; /**< The estimated absolute error. */
+    };
+
+    /**
+     * @brief Deduction guides for TanhSinh class.
+     * Allows the type of TanhSinh class to be deduced from the constructor parameters.
+     */
+    template<typename FN, typename BOUNDS_T>
+        requires IsFloatInvocable< FN > && IsFloatStruct< BOUNDS_T >
+    TanhSinh(FN, BOUNDS_T) -> TanhSinh< FN, StructCommonType_t< BOUNDS_T > >;
+
+    template<typename FN, typename ARG_T>
+        requires IsFloatInvocable< FN > && IsFloat< ARG_T >
+    TanhSinh(FN, std::initializer_list< ARG_T >) -> TanhSinh< FN, ARG_T >;
+
+
     // =================================================================================================================
     // 88
     // ""                ,d                                                       ,d
@@ -581,14 +1279,17 @@ namespace nxx::integrate
      * @param bounds The bounds of integration.
      * @param tolerance The tolerance for the result accuracy, defaults to machine epsilon for the result type.
      * @param maxIterations The maximum number of iterations allowed, defaults to 25.
+     * @param pool Optional thread pool used to evaluate the function at the new abscissae of each iteration
+     *             concurrently (see IntegrationBase::setExecutor). The result is identical to the serial result.
      * @return A tl::expected object containing either the result of the integration or an error.
      */
     template<template< typename, typename > class SOLVER_T,
         IsFloatInvocable FN, IsFloatStruct STRUCT_T, IsFloat TOL_T = StructCommonType_t< STRUCT_T >, std::integral ITER_T = int>
-    auto integrate(FN       function,
-                   STRUCT_T bounds,
-                   TOL_T    tolerance     = epsilon< StructCommonType_t< STRUCT_T > >(),
-                   ITER_T   maxIterations = 25)
+    auto integrate(FN          function,
+                   STRUCT_T    bounds,
+                   TOL_T       tolerance     = epsilon< StructCommonType_t< STRUCT_T > >(),
+                   ITER_T      maxIterations = 25,
+                   ThreadPool* pool          = nullptr)
     {
         using RESULT_T = StructCommonType_t< STRUCT_T >;
         using ERROR_T = Error< detail::IntegrationErrorData< RESULT_T, ITER_T > >; /**< Type for error handling. */
@@ -597,6 +1298,7 @@ namespace nxx::integrate
 
         const auto& [lower, upper] = bounds;
         auto        solver         = SOLVER_T< FN, RESULT_T >(function, bounds);
+        solver.setExecutor(pool);
 
         auto result = solver.current();
         if (!isfinite(result)) {
@@ -618,7 +1320,11 @@ namespace nxx::integrate
                                                             { .value = result, .eabs = 0.0, .erel = 0.0, .iterations = 0 })));
             }
 
-            eabs = abs(solver.current() - result);
+            // Solvers providing an error estimate (e.g. GaussKronrod) are checked against that instead.
+            if constexpr (requires { solver.error(); })
+                eabs = solver.error();
+            else
+                eabs = abs(solver.current() - result);
             erel = 1.0 - abs(solver.current() / result);
 
             if (eabs < tolerance)
@@ -649,6 +1355,7 @@ namespace nxx::integrate
      * @param bounds Array representing the bounds of integration.
      * @param tolerance The tolerance for the result accuracy, defaults to machine epsilon for the argument type.
      * @param maxIterations The maximum number of iterations allowed, defaults to 25.
+     * @param pool Optional thread pool used to evaluate the function at the new abscissae of each iteration concurrently.
      * @return A tl::expected object containing either the result of the integration or an error.
      */
     template<template< typename, typename > class SOLVER_T,
@@ -658,9 +1365,64 @@ namespace nxx::integrate
     auto integrate(FN            function,
                    const ARG_T (&bounds)[N],
                    TOL_T         tolerance     = epsilon< ARG_T >(),
-                   ITER_T        maxIterations = 25)
+                   ITER_T        maxIterations = 25,
+                   ThreadPool*   pool          = nullptr)
+    {
+        return integrate< SOLVER_T >(function, std::pair(bounds[0], bounds[1]), tolerance, maxIterations, pool);
+    }
+
+    /**
+     * @brief Performs numerical integration using a fixed-order quadrature rule.
+     *
+     * @details This overload of the integrate function applies a non-iterative quadrature rule, such as
+     *          GaussLegendre<N>, once over the given bounds. As there is no refinement, no tolerance or
+     *          maximum number of iterations is taken; the result is an error only if it is not finite.
+     *
+     * @tparam RULE_T The quadrature rule, e.g. GaussLegendre<10>.
+     * @tparam FN The type of function to be integrated.
+     * @tparam STRUCT_T The type of the structure representing bounds.
+     * @param function The function to be integrated.
+     * @param bounds The bounds of integration.
+     * @return A tl::expected object containing either the result of the integration or an error.
+     */
+    template<typename RULE_T, IsFloatInvocable FN, IsFloatStruct STRUCT_T>
+        requires RULE_T::IsQuadratureRule
+    auto integrate(FN function, STRUCT_T bounds)
+    {
+        using RESULT_T = StructCommonType_t< STRUCT_T >;
+        using ERROR_T = Error< detail::IntegrationErrorData< RESULT_T, int > >; /**< Type for error handling. */
+        using RETURN_T = tl::expected< RESULT_T, ERROR_T >;                     /**< Type for the function return value. */
+        using std::isfinite;
+
+        const auto [lower, upper] = bounds;
+        detail::validateRange(lower, upper);
+
+        const RESULT_T result = RULE_T{}(function, static_cast< RESULT_T >(lower), static_cast< RESULT_T >(upper));
+        if (!isfinite(result)) {
+            return RETURN_T(tl::make_unexpected(ERROR_T(RULE_T::SolverName + " integration failed: Result is not finite.",
+                                                        NumerixxErrorType::Integral,
+                                                        { .value = result, .eabs = 0.0, .erel = 0.0, .iterations = 1 })));
+        }
+
+        return RETURN_T(result);
+    }
+
+    /**
+     * @brief Overload of the integrate function for fixed-order quadrature rules, accepting bounds as an array.
+     *
+     * @tparam RULE_T The quadrature rule, e.g. GaussLegendre<10>.
+     * @tparam FN The type of function to be integrated.
+     * @tparam ARG_T The type of the argument for the bounds.
+     * @tparam N The size of the bounds array, must be 2.
+     * @param function The function to be integrated.
+     * @param bounds Array representing the bounds of integration.
+     * @return A tl::expected object containing either the result of the integration or an error.
+     */
+    template<typename RULE_T, IsFloatInvocable FN, IsFloat ARG_T, size_t N>
+        requires RULE_T::IsQuadratureRule && (N == 2)
+    auto integrate(FN function, const ARG_T (&bounds)[N])
     {
-        return integrate< SOLVER_T >(function, std::pair(bounds[0], bounds[1]), tolerance, maxIterations);
+        return integrate< RULE_T >(function, std::pair(bounds[0], bounds[1]));
     }
 
 
@@ -697,6 +1459,12 @@ namespace nxx::integrate
             FN m_function{}; /**< The function to be integrated. */
 
         public:
+            /**
+             * @brief Constructs the functor with the function to be integrated.
+             * @param function The function to be integrated.
+             */
+            explicit IntegrationFunctor(FN function) : m_function{ std::move(function) } {}
+
             /**
              * @brief Functor operator for integration with structure-based bounds.
              *
@@ -705,15 +1473,17 @@ namespace nxx::integrate
              * @param bounds The bounds of integration.
              * @param tol The tolerance for the result accuracy, defaults to machine epsilon for the result type.
              * @param iter The maximum number of iterations allowed, defaults to 25.
+             * @param pool Optional thread pool used to evaluate the function concurrently (see integrate).
              * @return The result of the integration.
              * @throws Throws an error if the integration result is an unexpected value.
              */
             template<IsFloatStruct STRUCT_T, IsFloat TOL_T = StructCommonType_t< STRUCT_T >>
-            auto operator()(STRUCT_T bounds,
-                            TOL_T    tol  = epsilon< StructCommonType_t< STRUCT_T > >(),
-                            int      iter = 25) const
+            auto operator()(STRUCT_T    bounds,
+                            TOL_T       tol  = epsilon< StructCommonType_t< STRUCT_T > >(),
+                            int         iter = 25,
+                            ThreadPool* pool = nullptr) const
             {
-                auto result = integrate< ALGO >(m_function, bounds, tol, iter);
+                auto result = integrate< ALGO >(m_function, bounds, tol, iter, pool);
                 if (result) return result.value();
                 throw result.error();
             }
@@ -727,19 +1497,71 @@ namespace nxx::integrate
              * @param bounds Array representing the bounds of integration.
              * @param tol The tolerance for the result accuracy, defaults to machine epsilon for the argument type.
              * @param iter The maximum number of iterations allowed, defaults to 25.
+             * @param pool Optional thread pool used to evaluate the function concurrently (see integrate).
              * @return The result of the integration.
              * @throws Throws an error if the integration result is an unexpected value.
              */
             template<IsFloat ARG_T, IsFloat TOL_T = ARG_T, size_t N>
             auto operator()(const ARG_T (&bounds)[N],
                             TOL_T         tol  = epsilon< ARG_T >(),
-                            int           iter = 25) const
+                            int           iter = 25,
+                            ThreadPool*   pool = nullptr) const
                 requires (N == 2)
             {
-                auto result = integrate< ALGO >(m_function, std::pair(bounds[0], bounds[1]), tol, iter);
+                auto result = integrate< ALGO >(m_function, std::pair(bounds[0], bounds[1]), tol, iter, pool);
+                if (result) return result.value();
+                throw result.error();
+            }
+        };
+
+        /**
+         * @class QuadratureFunctor
+         * @brief Functor class for fixed-order quadrature rules.
+         *
+         * @details This class encapsulates a function to be integrated by a non-iterative quadrature rule,
+         *          such as GaussLegendre<N>, and provides the same functor interface as IntegrationFunctor.
+         *
+         * @tparam RULE_T The quadrature rule.
+         * @tparam FN The type of function to be integrated.
+         */
+        template<typename RULE_T, IsFloatInvocable FN>
+        class QuadratureFunctor
+        {
+            FN m_function{}; /**< The function to be integrated. */
+
+        public:
+            /**
+             * @brief Constructs the functor with the function to be integrated.
+             * @param function The function to be integrated.
+             */
+            explicit QuadratureFunctor(FN function) : m_function{ std::move(function) } {}
+
+            /**
+             * @brief Functor operator for integration with structure-based bounds.
+             * @param bounds The bounds of integration.
+             * @return The result of the integration.
+             * @throws Throws an error if the integration result is an unexpected value.
+             */
+            template<IsFloatStruct STRUCT_T>
+            auto operator()(STRUCT_T bounds) const
+            {
+                auto result = integrate< RULE_T >(m_function, bounds);
                 if (result) return result.value();
                 throw result.error();
             }
+
+            /**
+             * @brief Functor operator for integration with array-based bounds.
+             * @param bounds Array representing the bounds of integration.
+             * @return The result of the integration.
+             * @throws Throws an error if the integration result is an unexpected value.
+             */
+            template<IsFloat ARG_T, size_t N>
+            auto operator()(const ARG_T (&bounds)[N]) const
+                requires (N == 2)
+            {
+                return (*this)(std::pair(bounds[0], bounds[1]));
+            }
         };
     } // namespace detail
 
@@ -756,7 +1578,19 @@ namespace nxx::integrate
      * @return An instance of IntegrationFunctor configured with the given function and algorithm.
      */
     template<template< typename, typename > class ALGO_T = Romberg, IsFloatInvocable FN>
-    auto integralOf(FN function) { return detail::IntegrationFunctor< ALGO_T, FN >(); }
+    auto integralOf(FN function) { return detail::IntegrationFunctor< ALGO_T, FN >(std::move(function)); }
+
+    /**
+     * @brief Factory function to create a QuadratureFunctor for a given function and fixed-order quadrature rule.
+     *
+     * @tparam RULE_T The quadrature rule, e.g. GaussLegendre<10>.
+     * @tparam FN The type of function to be integrated.
+     * @param function The function for which the integral functor is to be created.
+     * @return An instance of QuadratureFunctor configured with the given function and rule.
+     */
+    template<typename RULE_T, IsFloatInvocable FN>
+        requires RULE_T::IsQuadratureRule
+    auto integralOf(FN function) { return detail::QuadratureFunctor< RULE_T, FN >(std::move(function)); }
 } // namespace nxx::integrate
 
 #endif    // NUMERIXX_INTEGRATION_HPP
@@ -39,7 +39,7 @@
  * @brief Header file defining the IntegrationTraits structure for various integration solvers.
  *
  * This file contains the template specializations of the IntegrationTraits structure for the Trapezoid,
- * Romberg, and Simpson classes. IntegrationTraits is designed to provide type information relevant to
+ * Romberg, Simpson, GaussKronrod, GaussKronrod21 and TanhSinh classes. IntegrationTraits is designed to provide type information relevant to
  * the integration process, such as the types of the function, argument, and return value.
  */
 namespace nxx::integrate
@@ -56,6 +56,12 @@ namespace nxx::integrate
     class Romberg;
     template<IsFloatInvocable FN, IsFloat ARG_T>
     class Simpson;
+    template<IsFloatInvocable FN, IsFloat ARG_T>
+    class GaussKronrod;
+    template<IsFloatInvocable FN, IsFloat ARG_T>
+    class GaussKronrod21;
+    template<IsFloatInvocable FN, IsFloat ARG_T>
+    class TanhSinh;
 
     namespace detail
     {
@@ -112,6 +118,48 @@ namespace nxx::integrate
             using ARG_T = T;                                    /**< The type of the argument for the function. */
             using RETURN_T = std::invoke_result_t< FN, ARG_T >; /**< The type of the return value of the function. */
         };
+
+        /**
+         * @brief Specialization of IntegrationTraits for the GaussKronrod solver.
+         *
+         * @tparam FN The type of function to be integrated.
+         * @tparam T The type of the argument for the function.
+         */
+        template<typename FN, typename T>
+        struct IntegrationTraits< GaussKronrod< FN, T > >
+        {
+            using FUNCTION_T = FN;                              /**< The type of the function to be integrated. */
+            using ARG_T = T;                                    /**< The type of the argument for the function. */
+            using RETURN_T = std::invoke_result_t< FN, ARG_T >; /**< The type of the return value of the function. */
+        };
+
+        /**
+         * @brief Specialization of IntegrationTraits for the GaussKronrod21 solver.
+         *
+         * @tparam FN The type of function to be integrated.
+         * @tparam T The type of the argument for the function.
+         */
+        template<typename FN, typename T>
+        struct IntegrationTraits< GaussKronrod21< FN, T > >
+        {
+            using FUNCTION_T = FN;                              /**< The type of the function to be integrated. */
+            using ARG_T = T;                                    /**< The type of the argument for the function. */
+            using RETURN_T = std::invoke_result_t< FN, ARG_T >; /**< The type of the return value of the function. */
+        };
+
+        /**
+         * @brief Specialization of IntegrationTraits for the TanhSinh solver.
+         *
+         * @tparam FN The type of function to be integrated.
+         * @tparam T The type of the argument for the function.
+         */
+        template<typename FN, typename T>
+        struct IntegrationTraits< TanhSinh< FN, T > >
+        {
+            using FUNCTION_T = FN;                              /**< The type of the function to be integrated. */
+            using ARG_T = T;                                    /**< The type of the argument for the function. */
+            using RETURN_T = std::invoke_result_t< FN, ARG_T >; /**< The type of the return value of the function. */
+        };
     } // namespace detail
 }     // namespace nxx::integrate
 
@@ -32,5 +32,7 @@
 #define NUMERIXX_DERIV_HPP
 
 #include "impl/Derivatives.hpp"
+#include "impl/AutoDiff.hpp"
+#include "impl/ReverseAD.hpp"
 
 #endif    // NUMERIXX_DERIV_HPP
@@ -0,0 +1,396 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file AutoDiff.hpp
+ * @brief Provides a multi-lane dual number type for vector-mode forward automatic differentiation.
+ *
+ * A `Dual<T, N>` holds a value and N tangent components. When a generic function is evaluated with
+ * dual numbers, where the tangents of the inputs are seeded with unit vectors, the tangents of the
+ * result hold the exact partial derivatives with respect to N of the inputs at once.
+ *
+ * @note Functions to be differentiated must be generic (i.e. templated on the argument type), and must
+ * call the elementary functions unqualified (e.g. `sin(x)` rather than `std::sin(x)`), so that the
+ * overloads for `Dual` are found by argument-dependent lookup.
+ */
+
+#ifndef NUMERIXX_AUTODIFF_HPP
+#define NUMERIXX_AUTODIFF_HPP
+
+// ===== Numerixx Includes
+#include <Concepts.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+namespace nxx::deriv
+{
+    /**
+     * @brief Tag type for selecting vector-mode forward automatic differentiation.
+     *
+     * @tparam LANES The number of tangent components propagated per function evaluation.
+     */
+    template< size_t LANES >
+    requires(LANES > 0)
+    struct AutoDiffLanes
+    {
+        static constexpr bool   IsAutoDiff = true;  /**< Flag indicating the tag selects automatic differentiation. */
+        static constexpr size_t Lanes      = LANES; /**< The number of tangent components per sweep. */
+    };
+
+    /**
+     * @brief Default automatic differentiation tag, propagating four tangent components per sweep.
+     */
+    using AutoDiff = AutoDiffLanes< 4 >;
+
+    template< IsFloat T, size_t N >
+    requires(N > 0)
+    class Dual;
+}    // namespace nxx::deriv
+
+namespace nxx
+{
+    /**
+     * @brief Specialization allowing `deriv::Dual` to be used wherever a floating point type is expected.
+     */
+    template< IsFloat T, size_t N >
+    struct IsFloatExtension< deriv::Dual< T, N > > : std::true_type
+    {
+    };
+}    // namespace nxx
+
+namespace nxx::deriv
+{
+
+    /**
+     * @class Dual
+     * @brief A dual number with N tangent components, for vector-mode forward automatic differentiation.
+     *
+     * @details The tangent components are stored in a contiguous, aligned array, and all arithmetic on the tangents
+     *          consists of simple loops over the lanes, which the compiler can vectorize.
+     *
+     * @tparam T The underlying floating point type.
+     * @tparam N The number of tangent components.
+     */
+    template< IsFloat T, size_t N >
+    requires(N > 0)
+    class Dual
+    {
+        static constexpr size_t Alignment = std::min(std::bit_ceil(sizeof(T) * N), size_t { 64 });
+
+        T                                     m_value {};    /**< The value of the dual number. */
+        alignas(Alignment) std::array< T, N > m_tangents {}; /**< The tangent components. */
+
+        /**
+         * @brief Applies the chain rule for a unary function f, given f(a) and f'(a).
+         */
+        static constexpr Dual chain(const Dual& a, T value, T deriv)
+        {
+            Dual result(value);
+            for (size_t i = 0; i < N; ++i) result.m_tangents[i] = deriv * a.m_tangents[i];
+            return result;
+        }
+
+    public:
+        using value_type              = T; /**< The underlying floating point type. */
+        static constexpr size_t Lanes = N; /**< The number of tangent components. */
+
+        /**
+         * @brief Default constructor. Creates a zero-valued constant.
+         */
+        constexpr Dual() = default;
+
+        /**
+         * @brief Creates a constant (i.e. with zero tangents) from an arithmetic value.
+         * @param value The value.
+         */
+        template< typename S >
+        requires std::is_arithmetic_v< S > || std::same_as< S, T >
+        constexpr Dual(S value)    // NOLINT: implicit conversion allows mixing constants and dual numbers.
+            : m_value { static_cast< T >(value) }
+        {}
+
+        /**
+         * @brief Creates an independent variable, with the tangent of the given lane seeded to one.
+         * @param value The value of the variable.
+         * @param lane The lane to seed.
+         * @return The dual number representing the variable.
+         */
+        static constexpr Dual variable(T value, size_t lane)
+        {
+            Dual result(value);
+            result.m_tangents[lane] = T { 1.0 };
+            return result;
+        }
+
+        /**
+         * @brief Returns the value of the dual number.
+         */
+        constexpr T value() const { return m_value; }
+
+        /**
+         * @brief Returns the tangent component of the given lane.
+         * @param lane The lane.
+         */
+        constexpr T tangent(size_t lane) const { return m_tangents[lane]; }
+
+        /**
+         * @brief Returns all tangent components.
+         */
+        constexpr const std::array< T, N >& tangents() const { return m_tangents; }
+
+        explicit constexpr operator T() const { return m_value; }
+
+        constexpr Dual& operator+=(const Dual& other)
+        {
+            m_value += other.m_value;
+            for (size_t i = 0; i < N; ++i) m_tangents[i] += other.m_tangents[i];
+            return *this;
+        }
+
+        constexpr Dual& operator-=(const Dual& other)
+        {
+            m_value -= other.m_value;
+            for (size_t i = 0; i < N; ++i) m_tangents[i] -= other.m_tangents[i];
+            return *this;
+        }
+
+        constexpr Dual& operator*=(const Dual& other)
+        {
+            for (size_t i = 0; i < N; ++i) m_tangents[i] = m_tangents[i] * other.m_value + m_value * other.m_tangents[i];
+            m_value *= other.m_value;
+            return *this;
+        }
+
+        constexpr Dual& operator/=(const Dual& other)
+        {
+            const T inv = T { 1.0 } / other.m_value;
+            m_value *= inv;
+            for (size_t i = 0; i < N; ++i) m_tangents[i] = (m_tangents[i] - m_value * other.m_tangents[i]) * inv;
+            return *this;
+        }
+
+        // ===== Arithmetic operators
+
+        friend constexpr Dual operator+(const Dual& a) { return a; }
+
+        friend constexpr Dual operator-(const Dual& a)
+        {
+            Dual result(-a.m_value);
+            for (size_t i = 0; i < N; ++i) result.m_tangents[i] = -a.m_tangents[i];
+            return result;
+        }
+
+        friend constexpr Dual operator+(Dual a, const Dual& b) { return a += b; }
+        friend constexpr Dual operator-(Dual a, const Dual& b) { return a -= b; }
+        friend constexpr Dual operator*(Dual a, const Dual& b) { return a *= b; }
+        friend constexpr Dual operator/(Dual a, const Dual& b) { return a /= b; }
+
+        friend constexpr Dual operator+(Dual a, T b)
+        {
+            a.m_value += b;
+            return a;
+        }
+
+        friend constexpr Dual operator-(Dual a, T b)
+        {
+            a.m_value -= b;
+            return a;
+        }
+
+        friend constexpr Dual operator+(T a, const Dual& b) { return b + a; }
+        friend constexpr Dual operator-(T a, const Dual& b) { return -b + a; }
+
+        friend constexpr Dual operator*(Dual a, T b)
+        {
+            a.m_value *= b;
+            for (size_t i = 0; i < N; ++i) a.m_tangents[i] *= b;
+            return a;
+        }
+
+        friend constexpr Dual operator*(T a, const Dual& b) { return b * a; }
+        friend constexpr Dual operator/(const Dual& a, T b) { return a * (T { 1.0 } / b); }
+        friend constexpr Dual operator/(T a, const Dual& b) { return chain(b, a / b.m_value, -a / (b.m_value * b.m_value)); }
+
+        // ===== Comparison operators (based on the value only)
+
+        friend constexpr bool operator==(const Dual& a, const Dual& b) { return a.m_value == b.m_value; }
+        friend constexpr auto operator<=>(const Dual& a, const Dual& b) { return a.m_value <=> b.m_value; }
+
+        // ===== Elementary functions
+
+        friend Dual sqrt(const Dual& a)
+        {
+            using std::sqrt;
+            const T s = sqrt(a.m_value);
+            return chain(a, s, T { 0.5 } / s);
+        }
+
+        friend Dual cbrt(const Dual& a)
+        {
+            using std::cbrt;
+            const T c = cbrt(a.m_value);
+            return chain(a, c, T { 1.0 } / (3 * c * c));
+        }
+
+        friend Dual exp(const Dual& a)
+        {
+            using std::exp;
+            const T e = exp(a.m_value);
+            return chain(a, e, e);
+        }
+
+        friend Dual log(const Dual& a)
+        {
+            using std::log;
+            return chain(a, log(a.m_value), T { 1.0 } / a.m_value);
+        }
+
+        friend Dual log10(const Dual& a)
+        {
+            using std::log;
+            using std::log10;
+            return chain(a, log10(a.m_value), T { 1.0 } / (a.m_value * log(T { 10.0 })));
+        }
+
+        friend Dual pow(const Dual& a, T b)
+        {
+            using std::pow;
+            return chain(a, pow(a.m_value, b), b * pow(a.m_value, b - 1));
+        }
+
+        friend Dual pow(T a, const Dual& b)
+        {
+            using std::log;
+            using std::pow;
+            const T p = pow(a, b.m_value);
+            return chain(b, p, p * log(a));
+        }
+
+        friend Dual pow(const Dual& a, const Dual& b)
+        {
+            using std::log;
+            using std::pow;
+
+            // The value is computed directly, so negative bases with integer exponents are handled. The log(a) term
+            // only enters the lanes where the exponent has a tangent, as it is not finite for a <= 0.
+            Dual    result(pow(a.m_value, b.m_value));
+            const T da = b.m_value * pow(a.m_value, b.m_value - 1);
+            T       db { 0.0 };
+            if (std::any_of(b.m_tangents.begin(), b.m_tangents.end(), [](T t) { return t != T { 0.0 }; }))
+                db = result.m_value * log(a.m_value);
+            for (size_t i = 0; i < N; ++i)
+                result.m_tangents[i] = da * a.m_tangents[i] + (b.m_tangents[i] != T { 0.0 } ? db * b.m_tangents[i] : T { 0.0 });
+            return result;
+        }
+
+        friend Dual sin(const Dual& a)
+        {
+            using std::cos;
+            using std::sin;
+            return chain(a, sin(a.m_value), cos(a.m_value));
+        }
+
+        friend Dual cos(const Dual& a)
+        {
+            using std::cos;
+            using std::sin;
+            return chain(a, cos(a.m_value), -sin(a.m_value));
+        }
+
+        friend Dual tan(const Dual& a)
+        {
+            using std::tan;
+            const T t = tan(a.m_value);
+            return chain(a, t, 1 + t * t);
+        }
+
+        friend Dual asin(const Dual& a)
+        {
+            using std::asin;
+            using std::sqrt;
+            return chain(a, asin(a.m_value), T { 1.0 } / sqrt(1 - a.m_value * a.m_value));
+        }
+
+        friend Dual acos(const Dual& a)
+        {
+            using std::acos;
+            using std::sqrt;
+            return chain(a, acos(a.m_value), -T { 1.0 } / sqrt(1 - a.m_value * a.m_value));
+        }
+
+        friend Dual atan(const Dual& a)
+        {
+            using std::atan;
+            return chain(a, atan(a.m_value), T { 1.0 } / (1 + a.m_value * a.m_value));
+        }
+
+        friend Dual sinh(const Dual& a)
+        {
+            using std::cosh;
+            using std::sinh;
+            return chain(a, sinh(a.m_value), cosh(a.m_value));
+        }
+
+        friend Dual cosh(const Dual& a)
+        {
+            using std::cosh;
+            using std::sinh;
+            return chain(a, cosh(a.m_value), sinh(a.m_value));
+        }
+
+        friend Dual tanh(const Dual& a)
+        {
+            using std::tanh;
+            const T t = tanh(a.m_value);
+            return chain(a, t, 1 - t * t);
+        }
+
+        friend Dual abs(const Dual& a) { return a.m_value < 0 ? -a : a; }
+        friend Dual fabs(const Dual& a) { return abs(a); }
+
+        friend std::ostream& operator<<(std::ostream& os, const Dual& a)
+        {
+            os << a.m_value << " [";
+            for (size_t i = 0; i < N; ++i) os << (i == 0 ? "" : ", ") << a.m_tangents[i];
+            return os << "]";
+        }
+    };
+
+}    // namespace nxx::deriv
+
+#endif    // NUMERIXX_AUTODIFF_HPP
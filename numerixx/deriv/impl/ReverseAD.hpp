@@ -0,0 +1,484 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file ReverseAD.hpp
+ * @brief Provides a tape and an active scalar type for reverse-mode automatic differentiation.
+ *
+ * When a generic scalar function is evaluated with `Var` arguments, each elementary operation is recorded
+ * on a `Tape`, together with the local partial derivatives. A single reverse sweep over the tape then yields
+ * the gradient with respect to all inputs, at a cost that is a small constant multiple of one function
+ * evaluation, regardless of the number of inputs.
+ *
+ * @note As with `Dual`, functions to be differentiated must be generic, and must call the elementary
+ * functions unqualified, so that the overloads for `Var` are found by argument-dependent lookup.
+ */
+
+#ifndef NUMERIXX_REVERSEAD_HPP
+#define NUMERIXX_REVERSEAD_HPP
+
+// ===== Numerixx Includes
+#include <Concepts.hpp>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace nxx::deriv
+{
+    /**
+     * @brief Tag type for selecting reverse-mode automatic differentiation.
+     */
+    struct ReverseAD
+    {
+        static constexpr bool IsReverseAD = true; /**< Flag indicating the tag selects reverse-mode differentiation. */
+    };
+
+    template< IsFloat T >
+    class Var;
+}    // namespace nxx::deriv
+
+namespace nxx
+{
+    /**
+     * @brief Specialization allowing `deriv::Var` to be used wherever a floating point type is expected.
+     */
+    template< IsFloat T >
+    struct IsFloatExtension< deriv::Var< T > > : std::true_type
+    {
+    };
+}    // namespace nxx
+
+namespace nxx::deriv
+{
+    /**
+     * @class Tape
+     * @brief Records the elementary operations of a computation on `Var` objects, for a subsequent reverse sweep.
+     *
+     * @details Each recorded operation occupies one node, holding the indices of (at most) two operands and the
+     *          partial derivatives with respect to them. The nodes are stored in fixed-size blocks, which are
+     *          allocated from the heap only when the tape grows beyond its previous high-water mark. Rewinding the
+     *          tape to a checkpoint (or clearing it) releases the nodes, but keeps the blocks, so that repeated
+     *          gradient computations of the same function run without any heap allocation.
+     *
+     * @tparam T The underlying floating point type.
+     */
+    template< IsFloat T >
+    class Tape
+    {
+        friend class Var< T >;
+
+        struct Node
+        {
+            std::array< size_t, 2 > operands; /**< The indices of the operands. */
+            std::array< T, 2 >      partials; /**< The partial derivatives with respect to the operands. */
+        };
+
+        static constexpr size_t BlockShift = 12;
+        static constexpr size_t BlockSize  = size_t { 1 } << BlockShift;
+
+        std::vector< std::unique_ptr< Node[] > > m_blocks {};    /**< The memory pool of node blocks. */
+        size_t                                   m_size {};      /**< The number of nodes currently recorded. */
+        std::vector< T >                         m_adjoints {};  /**< The adjoints computed by the last reverse sweep. */
+        std::vector< Var< T > >                  m_arguments {}; /**< The buffer for the variables created by `variables`. */
+
+        /**
+         * @brief Records a node on the tape, and returns its index.
+         */
+        size_t record(size_t operand1, T partial1, size_t operand2, T partial2)
+        {
+            if (m_size == m_blocks.size() * BlockSize) m_blocks.emplace_back(std::make_unique< Node[] >(BlockSize));
+            m_blocks[m_size >> BlockShift][m_size & (BlockSize - 1)] = Node { { operand1, operand2 }, { partial1, partial2 } };
+            return m_size++;
+        }
+
+        const Node& node(size_t index) const { return m_blocks[index >> BlockShift][index & (BlockSize - 1)]; }
+
+    public:
+        /**
+         * @brief A position on the tape, which the tape can be rewound to.
+         */
+        struct Checkpoint
+        {
+            size_t position; /**< The number of recorded nodes at the time of the checkpoint. */
+        };
+
+        Tape() = default;
+
+        // The Var objects recorded on the tape refer to it by address; hence, the tape can be neither copied nor moved.
+        Tape(const Tape&)            = delete;
+        Tape(Tape&&)                 = delete;
+        Tape& operator=(const Tape&) = delete;
+        Tape& operator=(Tape&&)      = delete;
+
+        /**
+         * @brief Creates an independent variable on the tape.
+         * @param value The value of the variable.
+         * @return The active scalar representing the variable.
+         */
+        Var< T > variable(T value);
+
+        /**
+         * @brief Creates an independent variable on the tape for each of the given values.
+         * @param values A range of values.
+         * @return A view of the variables, which are stored in a buffer owned by the tape. The buffer is reused by
+         *         the next call, so that no memory is allocated once it is large enough.
+         * @note The view is invalidated by the next call; hence, the computation using the variables must not
+         *       itself call this function (e.g. by computing a nested gradient on the same tape).
+         */
+        template< typename RANGE_T >
+        std::span< Var< T > > variables(const RANGE_T& values)
+        {
+            m_arguments.clear();
+            for (const auto& value : values) m_arguments.push_back(variable(static_cast< T >(value)));
+            return { m_arguments.data(), m_arguments.size() };
+        }
+
+        /**
+         * @brief Returns a checkpoint for the current position of the tape.
+         */
+        Checkpoint checkpoint() const { return Checkpoint { m_size }; }
+
+        /**
+         * @brief Discards all nodes recorded after the given checkpoint. The memory is kept for reuse.
+         * @param checkpoint The checkpoint to rewind to.
+         * @note Var objects recorded after the checkpoint are invalidated.
+         */
+        void rewind(Checkpoint checkpoint) { m_size = std::min(checkpoint.position, m_size); }
+
+        /**
+         * @brief Discards all nodes on the tape. The memory is kept for reuse.
+         */
+        void clear() { m_size = 0; }
+
+        /**
+         * @brief Returns the number of nodes currently recorded on the tape.
+         */
+        size_t size() const { return m_size; }
+
+        /**
+         * @brief Returns the number of nodes the tape can hold without allocating memory.
+         */
+        size_t capacity() const { return m_blocks.size() * BlockSize; }
+
+        /**
+         * @brief Performs the reverse sweep, computing the adjoints of all nodes recorded up to the output.
+         * @param output The (scalar) output of the computation.
+         * @details After the sweep, the adjoint of each variable (i.e. the partial derivative of the output with
+         *          respect to the variable) can be retrieved using the `adjoint` member function.
+         */
+        void backward(const Var< T >& output);
+
+        /**
+         * @brief Returns the adjoint of a variable, computed by the last reverse sweep.
+         * @param var The variable.
+         * @return The partial derivative of the output with respect to the variable.
+         */
+        T adjoint(const Var< T >& var) const;
+    };
+
+    /**
+     * @class Var
+     * @brief An active scalar for reverse-mode automatic differentiation.
+     *
+     * @details A Var holds a value, and (unless it is a constant) the tape and the index of the node that
+     *          produced it. Arithmetic on Var objects computes the value and records the operation on the tape.
+     *
+     * @tparam T The underlying floating point type.
+     */
+    template< IsFloat T >
+    class Var
+    {
+        friend class Tape< T >;
+
+        T          m_value {};   /**< The value of the variable. */
+        size_t     m_index {};   /**< The index of the node on the tape. */
+        Tape< T >* m_tape {};    /**< The tape the variable is recorded on; nullptr for constants. */
+
+        Var(T value, size_t index, Tape< T >* tape)
+            : m_value { value },
+              m_index { index },
+              m_tape { tape }
+        {}
+
+        /**
+         * @brief Records the result of a unary operation f, given f(a) and f'(a).
+         */
+        static Var record(T value, const Var& a, T partial)
+        {
+            if (!a.m_tape) return Var(value);
+            return Var(value, a.m_tape->record(a.m_index, partial, a.m_index, T {}), a.m_tape);
+        }
+
+        /**
+         * @brief Records the result of a binary operation f, given f(a, b) and the partial derivatives.
+         */
+        static Var record(T value, const Var& a, T partialA, const Var& b, T partialB)
+        {
+            if (!a.m_tape) return record(value, b, partialB);
+            if (!b.m_tape) return record(value, a, partialA);
+            return Var(value, a.m_tape->record(a.m_index, partialA, b.m_index, partialB), a.m_tape);
+        }
+
+    public:
+        using value_type = T; /**< The underlying floating point type. */
+
+        /**
+         * @brief Default constructor. Creates a zero-valued constant.
+         */
+        Var() = default;
+
+        /**
+         * @brief Creates a constant (i.e. a value that is not recorded on any tape) from an arithmetic value.
+         * @param value The value.
+         */
+        template< typename S >
+        requires std::is_arithmetic_v< S > || std::same_as< S, T >
+        Var(S value)    // NOLINT: implicit conversion allows mixing constants and active variables.
+            : m_value { static_cast< T >(value) }
+        {}
+
+        /**
+         * @brief Returns the value of the variable.
+         */
+        T value() const { return m_value; }
+
+        /**
+         * @brief Returns true if the variable is recorded on a tape, i.e. if it is not a constant.
+         */
+        bool isActive() const { return m_tape != nullptr; }
+
+        explicit operator T() const { return m_value; }
+
+        Var& operator+=(const Var& other) { return *this = *this + other; }
+        Var& operator-=(const Var& other) { return *this = *this - other; }
+        Var& operator*=(const Var& other) { return *this = *this * other; }
+        Var& operator/=(const Var& other) { return *this = *this / other; }
+
+        // ===== Arithmetic operators
+
+        friend Var operator+(const Var& a) { return a; }
+        friend Var operator-(const Var& a) { return record(-a.m_value, a, T { -1.0 }); }
+
+        friend Var operator+(const Var& a, const Var& b) { return record(a.m_value + b.m_value, a, T { 1.0 }, b, T { 1.0 }); }
+        friend Var operator-(const Var& a, const Var& b) { return record(a.m_value - b.m_value, a, T { 1.0 }, b, T { -1.0 }); }
+        friend Var operator*(const Var& a, const Var& b) { return record(a.m_value * b.m_value, a, b.m_value, b, a.m_value); }
+
+        friend Var operator/(const Var& a, const Var& b)
+        {
+            const T inv = T { 1.0 } / b.m_value;
+            return record(a.m_value * inv, a, inv, b, -a.m_value * inv * inv);
+        }
+
+        // ===== Comparison operators (based on the value only)
+
+        friend bool operator==(const Var& a, const Var& b) { return a.m_value == b.m_value; }
+        friend auto operator<=>(const Var& a, const Var& b) { return a.m_value <=> b.m_value; }
+
+        // ===== Elementary functions
+
+        friend Var sqrt(const Var& a)
+        {
+            using std::sqrt;
+            const T s = sqrt(a.m_value);
+            return record(s, a, T { 0.5 } / s);
+        }
+
+        friend Var cbrt(const Var& a)
+        {
+            using std::cbrt;
+            const T c = cbrt(a.m_value);
+            return record(c, a, T { 1.0 } / (3 * c * c));
+        }
+
+        friend Var exp(const Var& a)
+        {
+            using std::exp;
+            const T e = exp(a.m_value);
+            return record(e, a, e);
+        }
+
+        friend Var log(const Var& a)
+        {
+            using std::log;
+            return record(log(a.m_value), a, T { 1.0 } / a.m_value);
+        }
+
+        friend Var log10(const Var& a)
+        {
+            using std::log;
+            using std::log10;
+            return record(log10(a.m_value), a, T { 1.0 } / (a.m_value * log(T { 10.0 })));
+        }
+
+        friend Var pow(const Var& a, T b)
+        {
+            using std::pow;
+            return record(pow(a.m_value, b), a, b * pow(a.m_value, b - 1));
+        }
+
+        friend Var pow(T a, const Var& b)
+        {
+            using std::log;
+            using std::pow;
+            const T p = pow(a, b.m_value);
+            return record(p, b, a > T { 0.0 } ? p * log(a) : T { 0.0 });
+        }
+
+        friend Var pow(const Var& a, const Var& b)
+        {
+            using std::log;
+            using std::pow;
+            // The partial with respect to the exponent involves log(a), which is not finite for a <= 0. It is taken as
+            // zero there, so that it does not poison the adjoints of the other variables in the backward sweep.
+            const T p = pow(a.m_value, b.m_value);
+            return record(p, a, b.m_value * pow(a.m_value, b.m_value - 1), b, a.m_value > T { 0.0 } ? p * log(a.m_value) : T { 0.0 });
+        }
+
+        friend Var sin(const Var& a)
+        {
+            using std::cos;
+            using std::sin;
+            return record(sin(a.m_value), a, cos(a.m_value));
+        }
+
+        friend Var cos(const Var& a)
+        {
+            using std::cos;
+            using std::sin;
+            return record(cos(a.m_value), a, -sin(a.m_value));
+        }
+
+        friend Var tan(const Var& a)
+        {
+            using std::tan;
+            const T t = tan(a.m_value);
+            return record(t, a, 1 + t * t);
+        }
+
+        friend Var asin(const Var& a)
+        {
+            using std::asin;
+            using std::sqrt;
+            return record(asin(a.m_value), a, T { 1.0 } / sqrt(1 - a.m_value * a.m_value));
+        }
+
+        friend Var acos(const Var& a)
+        {
+            using std::acos;
+            using std::sqrt;
+            return record(acos(a.m_value), a, -T { 1.0 } / sqrt(1 - a.m_value * a.m_value));
+        }
+
+        friend Var atan(const Var& a)
+        {
+            using std::atan;
+            return record(atan(a.m_value), a, T { 1.0 } / (1 + a.m_value * a.m_value));
+        }
+
+        friend Var sinh(const Var& a)
+        {
+            using std::cosh;
+            using std::sinh;
+            return record(sinh(a.m_value), a, cosh(a.m_value));
+        }
+
+        friend Var cosh(const Var& a)
+        {
+            using std::cosh;
+            using std::sinh;
+            return record(cosh(a.m_value), a, sinh(a.m_value));
+        }
+
+        friend Var tanh(const Var& a)
+        {
+            using std::tanh;
+            const T t = tanh(a.m_value);
+            return record(t, a, 1 - t * t);
+        }
+
+        friend Var abs(const Var& a) { return a.m_value < 0 ? -a : a; }
+        friend Var fabs(const Var& a) { return abs(a); }
+
+        friend std::ostream& operator<<(std::ostream& os, const Var& a) { return os << a.m_value; }
+    };
+
+    /**
+     * @brief Returns the default tape for the calling thread.
+     * @tparam T The underlying floating point type.
+     */
+    template< IsFloat T >
+    Tape< T >& defaultTape()
+    {
+        thread_local Tape< T > tape;
+        return tape;
+    }
+
+    template< IsFloat T >
+    Var< T > Tape< T >::variable(T value)
+    {
+        const size_t index = m_size;
+        return Var< T >(value, record(index, T {}, index, T {}), this);
+    }
+
+    template< IsFloat T >
+    void Tape< T >::backward(const Var< T >& output)
+    {
+        m_adjoints.assign(m_size, T {});
+        if (output.m_tape != this) return;
+
+        m_adjoints[output.m_index] = T { 1.0 };
+        for (size_t i = output.m_index + 1; i-- > 0;) {
+            const T adjoint = m_adjoints[i];
+            if (adjoint == T {}) continue;
+
+            const Node& n = node(i);
+            m_adjoints[n.operands[0]] += n.partials[0] * adjoint;
+            m_adjoints[n.operands[1]] += n.partials[1] * adjoint;
+        }
+    }
+
+    template< IsFloat T >
+    T Tape< T >::adjoint(const Var< T >& var) const
+    {
+        return var.m_tape == this && var.m_index < m_adjoints.size() ? m_adjoints[var.m_index] : T {};
+    }
+
+}    // namespace nxx::deriv
+
+#endif    // NUMERIXX_REVERSEAD_HPP
@@ -33,7 +33,12 @@
 
 #include "impl/MultiFunction.hpp"
 #include "impl/MultiFunctionArray.hpp"
+#include "impl/MultiFunctionSystem.hpp"
+#include "impl/StaticMultiFunction.hpp"
 #include "impl/MultiDerivatives.hpp"
 #include "impl/Multiroots.hpp"
+#include "impl/MultirootsBatch.hpp"
+#include "impl/BlockDecomposition.hpp"
+#include "impl/Continuation.hpp"
 
 #endif    // NUMERIXX_MULTIROOTS_HPP
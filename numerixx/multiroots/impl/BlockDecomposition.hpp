@@ -0,0 +1,320 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file BlockDecomposition.hpp
+ * @brief This file contains the block-triangular decomposition of systems of equations.
+ *
+ * Large systems of equations (e.g. flowsheet models) are usually reducible, i.e. the equations can be
+ * ordered such that the Jacobian is block lower triangular. The system can then be solved as a sequence
+ * of small subsystems, each of which only depends on the variables of the blocks solved before it.
+ * The decomposition is computed from the incidence pattern of the system (which variables appear in which
+ * equations), by finding a perfect matching between equations and variables, followed by Tarjan's algorithm
+ * for the strongly connected components of the resulting dependency graph.
+ */
+
+#ifndef NUMERIXX_BLOCKDECOMPOSITION_HPP
+#define NUMERIXX_BLOCKDECOMPOSITION_HPP
+
+// ===== Numerixx Includes
+#include "MultiFunctionArray.hpp"
+#include "MultiFunctionSystem.hpp"
+#include "Multiroots.hpp"
+#include <Constants.hpp>
+#include <Error.hpp>
+
+// ===== External Includes
+#include <blaze/Blaze.h>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nxx::multiroots
+{
+    /**
+     * @brief The incidence pattern of a system of equations; element i holds the indices of the variables appearing in equation i.
+     */
+    using IncidencePattern = std::vector< std::vector< size_t > >;
+
+    /**
+     * @brief A block of the block-triangular decomposition, i.e. a subsystem to be solved simultaneously.
+     */
+    struct Block
+    {
+        std::vector< size_t > equations {}; ///< The indices of the equations of the block.
+        std::vector< size_t > variables {}; ///< The indices of the variables solved for by the block.
+    };
+
+    /**
+     * @brief Determines the incidence pattern of a function array, by perturbing one variable at a time.
+     *
+     * @details Variable j is considered to appear in equation i if the value of equation i changes when variable j
+     *          is perturbed. This requires N+1 evaluations of each of the N functions. A dependency may be missed if
+     *          it happens to vanish at the given point (e.g. a product with a variable that is zero), so the point
+     *          should be chosen generic, or the pattern should be declared explicitly.
+     *
+     * @param functions The function array.
+     * @param point The point at which the pattern is probed.
+     * @return The incidence pattern.
+     */
+    template< typename RES_T, typename PARAM_T, typename CONTAINER_T >
+    IncidencePattern probeIncidence(const MultiFunctionArray< RES_T, PARAM_T >& functions, const CONTAINER_T& point)
+    {
+        using std::abs;
+        using std::max;
+        using std::sqrt;
+
+        std::vector< PARAM_T > x(point.begin(), point.end());
+        std::vector< RES_T >   f0(functions.size());
+        functions(x, f0);
+
+        IncidencePattern pattern(functions.size());
+        for (size_t j = 0; j < x.size(); ++j) {
+            const PARAM_T value = x[j];
+            x[j] += sqrt(std::numeric_limits< PARAM_T >::epsilon()) * max(PARAM_T { 1 }, abs(value));
+            for (size_t i = 0; i < functions.size(); ++i)
+                if (functions[i](std::span< const PARAM_T >(x)) != f0[i]) pattern[i].push_back(j);
+            x[j] = value;
+        }
+
+        return pattern;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Finds an augmenting path from equation `eq`, for the maximum matching of equations to variables.
+         * @return true if the matching was augmented, otherwise false.
+         */
+        inline bool augmentMatching(const IncidencePattern&  pattern,
+                                    size_t                   eq,
+                                    std::vector< size_t >&   matchOfVariable,
+                                    std::vector< unsigned >& visited,
+                                    unsigned                 stamp)
+        {
+            for (const auto var : pattern[eq]) {
+                if (visited[var] == stamp) continue;
+                visited[var] = stamp;
+                if (matchOfVariable[var] == std::numeric_limits< size_t >::max() ||
+                    augmentMatching(pattern, matchOfVariable[var], matchOfVariable, visited, stamp)) {
+                    matchOfVariable[var] = eq;
+                    return true;
+                }
+            }
+            return false;
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Computes the block-triangular decomposition of a square system of equations.
+     *
+     * @details Each equation is first assigned a variable to solve for (a perfect matching of the bipartite incidence
+     *          graph). Equation i then depends on equation k, if the variable assigned to k appears in i. The strongly
+     *          connected components of this dependency graph are the blocks, which are returned in an order where each
+     *          block only depends on the blocks before it.
+     *
+     * @param pattern The incidence pattern of the system.
+     * @return The blocks, in the order in which they must be solved.
+     * @throws NumerixxError If the system is not square, or if it is structurally singular (i.e. no perfect matching exists).
+     */
+    inline std::vector< Block > decompose(const IncidencePattern& pattern)
+    {
+        constexpr size_t NONE = std::numeric_limits< size_t >::max();
+        const size_t     n    = pattern.size();
+
+        for (const auto& vars : pattern)
+            for (const auto var : vars)
+                if (var >= n) throw NumerixxError("The system of equations is not square.", NumerixxErrorType::MultiRoots);
+
+        // Find a perfect matching between equations and variables, using augmenting paths.
+        std::vector< size_t >   matchOfVariable(n, NONE);
+        std::vector< unsigned > visited(n, 0);
+        for (size_t eq = 0; eq < n; ++eq)
+            if (!detail::augmentMatching(pattern, eq, matchOfVariable, visited, static_cast< unsigned >(eq + 1)))
+                throw NumerixxError("The system of equations is structurally singular (equation " + std::to_string(eq) + ").",
+                                    NumerixxErrorType::MultiRoots);
+
+        std::vector< size_t > variableOfEquation(n);
+        for (size_t var = 0; var < n; ++var) variableOfEquation[matchOfVariable[var]] = var;
+
+        // Find the strongly connected components (Tarjan's algorithm, iteratively). A component is completed only after
+        // all the components it depends on, so the components are found in the order in which they must be solved.
+        std::vector< Block >                       blocks;
+        std::vector< size_t >                      index(n, NONE);
+        std::vector< size_t >                      lowlink(n, 0);
+        std::vector< bool >                        onStack(n, false);
+        std::vector< size_t >                      stack;
+        std::vector< std::pair< size_t, size_t > > callStack;    // (equation, position in its list of variables)
+        size_t                                     counter = 0;
+
+        for (size_t root = 0; root < n; ++root) {
+            if (index[root] != NONE) continue;
+            callStack.emplace_back(root, 0);
+
+            while (!callStack.empty()) {
+                auto& [eq, pos] = callStack.back();
+                if (pos == 0) {
+                    index[eq] = lowlink[eq] = counter++;
+                    stack.push_back(eq);
+                    onStack[eq] = true;
+                }
+
+                bool descended = false;
+                while (pos < pattern[eq].size()) {
+                    const size_t next = matchOfVariable[pattern[eq][pos++]];
+                    if (index[next] == NONE) {
+                        callStack.emplace_back(next, 0);
+                        descended = true;
+                        break;
+                    }
+                    if (onStack[next]) lowlink[eq] = std::min(lowlink[eq], index[next]);
+                }
+                if (descended) continue;
+
+                const size_t current = eq;
+                callStack.pop_back();
+                if (!callStack.empty()) lowlink[callStack.back().first] = std::min(lowlink[callStack.back().first], lowlink[current]);
+
+                if (lowlink[current] == index[current]) {
+                    Block  block;
+                    size_t member;
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = false;
+                        block.equations.push_back(member);
+                    } while (member != current);
+
+                    std::sort(block.equations.begin(), block.equations.end());
+                    for (const auto e : block.equations) block.variables.push_back(variableOfEquation[e]);
+                    blocks.push_back(std::move(block));
+                }
+            }
+        }
+
+        return blocks;
+    }
+
+    /**
+     * @brief Solves a system of equations block by block, using a specified solver template for each block.
+     *
+     * @details The blocks are solved in sequence. Each block is solved as a MultiFunctionSystem in the variables of the
+     *          block, with the variables of the preceding blocks fixed at their solved values, and with only the equations
+     *          of the block being evaluated. Hence, the cost of one large, dense Newton problem is replaced by that of many
+     *          small ones.
+     *
+     * @tparam SOLVER_T Template class of the solver used for each block.
+     * @tparam RES_T The return type of the functions.
+     * @tparam PARAM_T The parameter type of the functions.
+     * @tparam ARR_T Container type for the initial guess.
+     * @param functions The function array.
+     * @param guess Initial guess for the roots (of the full system).
+     * @param blocks The block-triangular decomposition, as computed by `decompose`.
+     * @param eps Convergence tolerance, applied to each block.
+     * @param maxiter Maximum number of iterations, applied to each block.
+     * @return An instance of tl::expected containing the result or an error. The number of iterations is the total
+     *         over all blocks, the residual is the norm of the full system at the solution, and the result is
+     *         converged if all blocks converged.
+     */
+    template< template< typename, typename > class SOLVER_T,
+              typename RES_T,
+              typename PARAM_T,
+              typename ARR_T,
+              IsFloat       EPS_T  = traits::ContainerValueType_t< ARR_T >,
+              std::integral ITER_T = int >
+    auto multisolve(const MultiFunctionArray< RES_T, PARAM_T >& functions,
+                    const ARR_T&                                guess,
+                    const std::vector< Block >&                 blocks,
+                    EPS_T                                       eps     = epsilon< traits::ContainerValueType_t< ARR_T > >(),
+                    ITER_T                                      maxiter = iterations< traits::ContainerValueType_t< ARR_T > >())
+    {
+        using ERROR_T  = std::runtime_error;
+        using RESULT_T = MultirootResult< RES_T >;
+        using RETURN_T = tl::expected< RESULT_T, ERROR_T >;
+
+        std::vector< PARAM_T > x(guess.begin(), guess.end());
+        std::vector< RES_T >   blockGuess;
+        int                    iterations = 0;
+        bool                   converged  = true;
+
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            const auto& block = blocks[b];
+
+            auto subsystem = MultiFunctionSystem([&](std::span< const RES_T > xb, std::span< RES_T > fb) {
+                for (size_t k = 0; k < xb.size(); ++k) x[block.variables[k]] = static_cast< PARAM_T >(xb[k]);
+                for (size_t k = 0; k < fb.size(); ++k) fb[k] = functions[block.equations[k]](std::span< const PARAM_T >(x));
+            });
+
+            blockGuess.clear();
+            for (const auto var : block.variables) blockGuess.push_back(static_cast< RES_T >(x[var]));
+
+            auto result = multisolve< SOLVER_T >(subsystem, blockGuess, eps, maxiter);
+            if (!result) return RETURN_T(tl::make_unexpected(ERROR_T(std::string(result.error().what()) + " (block " + std::to_string(b) + ")")));
+
+            for (size_t k = 0; k < block.variables.size(); ++k) x[block.variables[k]] = static_cast< PARAM_T >(result->root[k]);
+            iterations += result->iterations;
+            converged = converged && result->converged;
+        }
+
+        blaze::DynamicVector< RES_T > root(x.size());
+        std::copy(x.begin(), x.end(), root.begin());
+        const auto residual = norm(functions.template eval< blaze::DynamicVector >(x));
+        return RETURN_T(RESULT_T { std::move(root), residual, iterations, converged });
+    }
+
+    /**
+     * @brief Solves a system of equations block by block, using an initializer list as the guess.
+     * @details See the overload taking a container as the initial guess.
+     */
+    template< template< typename, typename > class SOLVER_T,
+              typename RES_T,
+              typename PARAM_T,
+              IsFloat       ARG_T,
+              IsFloat       EPS_T  = ARG_T,
+              std::integral ITER_T = int >
+    auto multisolve(const MultiFunctionArray< RES_T, PARAM_T >& functions,
+                    std::initializer_list< ARG_T >              guess,
+                    const std::vector< Block >&                 blocks,
+                    EPS_T                                       eps     = epsilon< ARG_T >(),
+                    ITER_T                                      maxiter = iterations< ARG_T >())
+    {
+        return multisolve< SOLVER_T >(functions, std::vector< ARG_T >(guess), blocks, eps, maxiter);
+    }
+
+}    // namespace nxx::multiroots
+
+#endif    // NUMERIXX_BLOCKDECOMPOSITION_HPP
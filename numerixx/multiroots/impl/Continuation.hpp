@@ -0,0 +1,417 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/**
+ * @file Continuation.hpp
+ * @brief This file contains the continuation driver for parametrized systems of equations.
+ *
+ * Given a system F(x; lambda) = 0, the driver traces the branch of solutions x(lambda) from a starting point,
+ * rather than solving the system from scratch for each value of lambda. Each step consists of a tangent
+ * predictor, computed from the Jacobian at the last point on the branch, and a chord Newton corrector, which
+ * reuses the LU factorization of that Jacobian. In the natural-parameter mode, lambda is the step parameter;
+ * in the pseudo-arclength mode, the arclength along the branch is, which allows the branch to be followed
+ * around turning points (folds), where dx/dlambda is unbounded.
+ */
+
+#ifndef NUMERIXX_CONTINUATION_HPP
+#define NUMERIXX_CONTINUATION_HPP
+
+// ===== Numerixx Includes
+#include "MultiDerivatives.hpp"
+#include <Concepts.hpp>
+#include <Error.hpp>
+
+// ===== External Includes
+#include <blaze/Blaze.h>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace nxx::multiroots
+{
+    /**
+     * @brief The parametrization used for tracing a branch of solutions.
+     */
+    enum class ContinuationMode {
+        NaturalParameter, /**< Steps are taken in lambda; fails at turning points. */
+        PseudoArclength   /**< Steps are taken along the branch; follows the branch around turning points. */
+    };
+
+    /**
+     * @brief The settings for the continuation driver.
+     * @tparam T The floating point type of the system.
+     */
+    template< IsFloat T >
+    struct ContinuationSettings
+    {
+        ContinuationMode mode { ContinuationMode::PseudoArclength }; /**< The parametrization of the branch. */
+        T                initialStep { 0.05 };                       /**< The length of the first step. */
+        T                minStep { 1E-8 };                           /**< The step length below which the tracing stops. */
+        T                maxStep { 0.5 };                            /**< The maximum step length. */
+        T                tolerance { 1E-10 };                        /**< The tolerance for ||F|| in the corrector. */
+        size_t           maxCorrections { 8 };                       /**< The maximum number of corrector iterations. */
+        size_t           maxSteps { 1000 };                          /**< The maximum number of steps. */
+    };
+
+    /**
+     * @brief A point on a branch of solutions.
+     * @tparam T The floating point type of the system.
+     */
+    template< IsFloat T >
+    struct ContinuationPoint
+    {
+        blaze::DynamicVector< T > x {};           /**< The solution. */
+        T                         lambda {};      /**< The value of the parameter. */
+        size_t                    corrections {}; /**< The number of corrector iterations used for the point. */
+    };
+
+    /**
+     * @brief The result of tracing a branch of solutions.
+     * @tparam T The floating point type of the system.
+     */
+    template< IsFloat T >
+    struct ContinuationResult
+    {
+        std::vector< ContinuationPoint< T > > branch {};      /**< The points on the branch, starting with the corrected guess. */
+        bool                                  completed {};   /**< Whether the branch was traced to the final value of lambda. */
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Traces a branch of solutions of F(x; lambda) = 0.
+         * @details The system is augmented with one equation, c^T * (y - y_p) = 0, where y = (x, lambda) and y_p is
+         *          the predicted point. For the natural-parameter mode, c is the unit vector for lambda; for the
+         *          pseudo-arclength mode, it is the tangent of the branch. The factors of the matrix A = [dF/dy; c^T]
+         *          serve both for the computation of the tangent, A * t = e, and for the chord iterations of the corrector.
+         * @tparam FUNCTION_T The type of the system, invocable as `function(std::span<const T> x, T lambda, std::span<T> f)`.
+         * @tparam T The floating point type of the system.
+         */
+        template< typename FUNCTION_T, IsFloat T >
+        class ContinuationTracer
+        {
+            using VECTOR_T = blaze::DynamicVector< T >;
+            using MATRIX_T = blaze::DynamicMatrix< T, blaze::columnMajor >;
+
+            FUNCTION_T                       m_function;      /**< The system F(x; lambda). */
+            ContinuationSettings< T >        m_settings;      /**< The settings. */
+            size_t                           m_size;          /**< The number of equations, n. */
+            VECTOR_T                         m_point;         /**< The last point on the branch, y = (x, lambda). */
+            VECTOR_T                         m_tangent;       /**< The tangent of the branch at the last point. */
+            MATRIX_T                         m_lu;            /**< The LU factors of the augmented matrix. */
+            std::vector< blaze::blas_int_t > m_pivots;        /**< The pivot indices of the LU factorization. */
+            std::vector< T >                 m_fplus;         /**< Buffer for the Jacobian computation. */
+            std::vector< T >                 m_fminus;        /**< Buffer for the Jacobian computation. */
+            VECTOR_T                         m_residual;      /**< Buffer for the residual of the augmented system. */
+            bool                             m_refactorized;  /**< Whether the corrector has replaced the factors of the last point. */
+            T                                m_contraction;   /**< The contraction of the residual in the first corrector iteration. */
+
+            /**
+             * @brief Evaluates F at y = (x, lambda).
+             */
+            void evaluate(const VECTOR_T& y, std::span< T > f) { m_function(std::span< const T >(y.data(), m_size), y[m_size], f); }
+
+            /**
+             * @brief Computes the Jacobian dF/dy at y, and factorizes the augmented matrix with the given last row.
+             * @return true if the factorization succeeded, otherwise false.
+             */
+            bool factorize(const VECTOR_T& y, const VECTOR_T& row)
+            {
+                const size_t              n = m_size;
+                blaze::DynamicMatrix< T > J(n, n + 1, T {});
+                std::vector< T >          args(y.begin(), y.end());
+                auto                      augmented = [this](std::span< const T > yy, std::span< T > f) {
+                    m_function(yy.first(m_size), yy[m_size], f);
+                };
+                deriv::detail::jacobianByColumns(augmented, args, m_fplus, m_fminus, J);
+
+                m_lu.resize(n + 1, n + 1, false);
+                for (size_t i = 0; i < n; ++i)
+                    for (size_t j = 0; j <= n; ++j) m_lu(i, j) = J(i, j);
+                for (size_t j = 0; j <= n; ++j) m_lu(n, j) = row[j];
+
+                try {
+                    blaze::getrf(m_lu, m_pivots.data());
+                }
+                catch (const std::exception&) {
+                    return false;
+                }
+                for (size_t i = 0; i <= n; ++i)
+                    if (!(std::abs(m_lu(i, i)) > 0)) return false;
+                return true;
+            }
+
+            /**
+             * @brief Corrects the predicted point by chord Newton iterations on the augmented system.
+             * @details The first iteration uses the stored factors. If it does not converge, the augmented matrix is
+             *          refactorized at the first iterate, and the new factors are used for the remaining iterations;
+             *          they are refactorized again only if an iteration reduces the residual by less than a factor of
+             *          four. If the residual grows right after a refactorization, the correction fails. With `newton`
+             *          set, the matrix is refactorized in every iteration, i.e. Newton's method is used.
+             * @param y The predicted point on input; the corrected point on output.
+             * @param row The vector c of the constraint c^T * (y - y_p) = 0.
+             * @param newton Whether to refactorize the matrix in every iteration.
+             * @return The number of iterations if converged, otherwise an empty optional.
+             */
+            std::optional< size_t > correct(VECTOR_T& y, const VECTOR_T& row, bool newton = false)
+            {
+                const size_t   n         = m_size;
+                const VECTOR_T predicted = y;
+                bool           refreshed = false;
+                T              previous  = std::numeric_limits< T >::infinity();
+                const T        contraction { 0.25 };
+                m_contraction = T {};
+
+                for (size_t iter = 0; iter <= m_settings.maxCorrections; ++iter) {
+                    evaluate(y, std::span< T >(m_residual.data(), n));
+                    T constraint {};
+                    for (size_t j = 0; j <= n; ++j) constraint += row[j] * (y[j] - predicted[j]);
+                    m_residual[n] = constraint;
+
+                    T fnorm {};
+                    for (size_t i = 0; i < n; ++i) fnorm += m_residual[i] * m_residual[i];
+                    fnorm = std::sqrt(fnorm);
+                    if (!std::isfinite(fnorm)) return {};
+                    if (fnorm < m_settings.tolerance && std::abs(constraint) < m_settings.tolerance) return iter;
+                    if (iter == m_settings.maxCorrections) break;
+
+                    const T norm = std::hypot(fnorm, constraint);
+                    if (iter == 1) m_contraction = norm / previous;
+                    if (refreshed && !(norm < previous)) return {};
+                    refreshed = iter > 0 && (newton || iter == 1 || !(norm <= contraction * previous));
+                    if (refreshed) {
+                        m_refactorized = true;
+                        if (!factorize(y, row)) return {};
+                    }
+                    previous = norm;
+
+                    blaze::getrs(m_lu, m_residual, 'N', m_pivots.data());
+                    y -= m_residual;
+                }
+
+                return {};
+            }
+
+            /**
+             * @brief Computes the tangent at the last point from the stored factors, A * t = e_n.
+             * @param previous The previous tangent, used for the orientation.
+             */
+            void computeTangent(const VECTOR_T& previous)
+            {
+                const size_t n = m_size;
+                VECTOR_T     t(n + 1, T {});
+                t[n] = 1;
+                blaze::getrs(m_lu, t, 'N', m_pivots.data());
+
+                if (m_settings.mode == ContinuationMode::PseudoArclength) {
+                    T length {};
+                    for (size_t j = 0; j <= n; ++j) length += t[j] * t[j];
+                    length = std::sqrt(length);
+                    T orientation {};
+                    for (size_t j = 0; j <= n; ++j) orientation += t[j] * previous[j];
+                    if (orientation < 0) length = -length;
+                    for (size_t j = 0; j <= n; ++j) t[j] /= length;
+                }
+
+                m_tangent = std::move(t);
+            }
+
+        public:
+            /**
+             * @brief Constructor.
+             * @param function The system F(x; lambda).
+             * @param settings The settings.
+             * @param size The number of equations.
+             */
+            ContinuationTracer(FUNCTION_T function, ContinuationSettings< T > settings, size_t size)
+                : m_function { std::move(function) },
+                  m_settings { settings },
+                  m_size { size },
+                  m_point(size + 1),
+                  m_tangent(size + 1),
+                  m_pivots(size + 1),
+                  m_fplus(size),
+                  m_fminus(size),
+                  m_residual(size + 1),
+                  m_refactorized { false },
+                  m_contraction {}
+            {}
+
+            /**
+             * @brief Traces the branch from the guess at lambda0 to lambdaEnd.
+             */
+            template< typename CONTAINER_T >
+            ContinuationResult< T > trace(const CONTAINER_T& guess, T lambda0, T lambdaEnd)
+            {
+                const size_t n         = m_size;
+                const T      direction = lambdaEnd >= lambda0 ? T { 1 } : T { -1 };
+                const bool   natural   = m_settings.mode == ContinuationMode::NaturalParameter;
+
+                VECTOR_T unitLambda(n + 1, T {});
+                unitLambda[n] = 1;
+
+                ContinuationResult< T > result;
+                auto                    record = [&](const VECTOR_T& y, size_t corrections) {
+                    result.branch.push_back({ VECTOR_T(n), y[n], corrections });
+                    for (size_t i = 0; i < n; ++i) result.branch.back().x[i] = y[i];
+                };
+
+                // Correct the initial guess, with lambda fixed.
+                std::copy(guess.begin(), guess.end(), m_point.begin());
+                m_point[n] = lambda0;
+                if (!factorize(m_point, unitLambda))
+                    throw NumerixxError("Continuation: the Jacobian at the initial guess is singular.", NumerixxErrorType::MultiRoots);
+                const auto initial = correct(m_point, unitLambda, true);
+                if (!initial) throw NumerixxError("Continuation: the initial guess could not be corrected.", NumerixxErrorType::MultiRoots);
+                record(m_point, *initial);
+
+                VECTOR_T previous = direction * unitLambda;
+                computeTangent(previous);
+                T step = m_settings.initialStep;
+
+                const T endTolerance = 4 * std::numeric_limits< T >::epsilon() * (1 + std::abs(lambdaEnd));
+                for (size_t count = 0; count < m_settings.maxSteps; ++count) {
+                    if (natural) {
+                        const T remaining = std::abs(lambdaEnd - m_point[n]);
+                        if (remaining <= endTolerance) {
+                            result.completed = true;
+                            break;
+                        }
+                        step = std::min(step, remaining);
+                    }
+
+                    // Predictor: a step along the tangent; for the natural parameter, the tangent is (dx/dlambda, 1).
+                    VECTOR_T       trial       = m_point + (natural ? direction * step : step) * m_tangent;
+                    const VECTOR_T row         = natural ? unitLambda : m_tangent;
+                    m_refactorized             = false;
+                    const auto     corrections = correct(trial, row);
+
+                    if (!corrections) {
+                        step /= 2;
+                        if (step < m_settings.minStep) break;
+                        if (m_refactorized && !factorize(m_point, natural ? unitLambda : previous)) break;
+                        continue;
+                    }
+
+                    // If the branch crosses lambdaEnd, the final point is corrected with lambda fixed at lambdaEnd.
+                    if (!natural && (trial[n] - lambdaEnd) * direction >= 0) {
+                        const T  fraction = (lambdaEnd - m_point[n]) / (trial[n] - m_point[n]);
+                        VECTOR_T last     = m_point + fraction * (trial - m_point);
+                        last[n]           = lambdaEnd;
+                        if (factorize(last, unitLambda)) {
+                            if (const auto corrected = correct(last, unitLambda, true)) {
+                                record(last, *corrected);
+                                result.completed = true;
+                                break;
+                            }
+                        }
+                    }
+
+                    m_point = std::move(trial);
+                    record(m_point, *corrections);
+
+                    // Adapt the step length to the contraction of the corrector; as the error of the predictor is
+                    // O(step^2), the step is scaled by sqrt(target / contraction), limited to [0.5, 2].
+                    const T target = 0.1;
+                    const T factor = m_contraction > 0 ? std::sqrt(target / m_contraction) : T { 2 };
+                    step           = std::clamp(step * std::clamp(factor, T { 0.5 }, T { 2 }), m_settings.minStep, m_settings.maxStep);
+
+                    // The tangent at the new point is computed from the factors of the corrector, if it has refactorized
+                    // the matrix close to the new point; otherwise the matrix is factorized at the new point.
+                    previous = m_tangent;
+                    if (!m_refactorized && !factorize(m_point, natural ? unitLambda : previous)) break;
+                    computeTangent(previous);
+                }
+
+                return result;
+            }
+        };
+    }    // namespace detail
+
+    /**
+     * @brief Traces a branch of solutions of the parametrized system F(x; lambda) = 0, from lambda0 to lambdaEnd.
+     *
+     * @details The guess is first corrected at lambda0. Then, each step predicts the next point along the tangent of
+     *          the branch, and corrects it by chord Newton iterations. The first iteration reuses the LU factors of
+     *          the augmented Jacobian at the previous point; the matrix is then refactorized at the first iterate,
+     *          and the new factors serve both the remaining iterations and the tangent at the new point. Hence, a
+     *          step typically costs one Jacobian and two to four evaluations of F. The step length is adapted such
+     *          that the first corrector iteration reduces the residual by a factor of about ten, and is halved (and
+     *          the step retried) when the corrector fails.
+     *          In the pseudo-arclength mode, the branch is followed around turning points, so lambda need not be
+     *          monotonic along the branch; when the branch crosses lambdaEnd, the final point is computed at lambdaEnd.
+     *
+     * @tparam FUNCTION_T The type of the system, invocable as `function(std::span<const T> x, T lambda, std::span<T> f)`.
+     * @tparam CONTAINER_T The container type of the guess.
+     * @tparam T The floating point type of the system.
+     * @param function The system F(x; lambda).
+     * @param guess A guess of the solution at lambda0.
+     * @param lambda0 The initial value of the parameter.
+     * @param lambdaEnd The final value of the parameter.
+     * @param settings The settings.
+     * @return The traced branch, and whether lambdaEnd was reached.
+     * @throws NumerixxError If the guess cannot be corrected to a solution at lambda0.
+     */
+    template< typename FUNCTION_T, typename CONTAINER_T, IsFloat T >
+    requires std::invocable< FUNCTION_T&, std::span< const T >, T, std::span< T > >
+    ContinuationResult< T > continuation(FUNCTION_T                function,
+                                         const CONTAINER_T&        guess,
+                                         T                         lambda0,
+                                         T                         lambdaEnd,
+                                         ContinuationSettings< T > settings = {})
+    {
+        detail::ContinuationTracer< FUNCTION_T, T > tracer(std::move(function), settings, std::size(guess));
+        return tracer.trace(guess, lambda0, lambdaEnd);
+    }
+
+    /**
+     * @brief Traces a branch of solutions of the parametrized system F(x; lambda) = 0, with an initializer list as the guess.
+     */
+    template< typename FUNCTION_T, IsFloat T >
+    requires std::invocable< FUNCTION_T&, std::span< const T >, T, std::span< T > >
+    ContinuationResult< T > continuation(FUNCTION_T                function,
+                                         std::initializer_list< T > guess,
+                                         T                         lambda0,
+                                         T                         lambdaEnd,
+                                         ContinuationSettings< T > settings = {})
+    {
+        return continuation(std::move(function), std::vector< T >(guess), lambda0, lambdaEnd, settings);
+    }
+}    // namespace nxx::multiroots
+
+#endif    // NUMERIXX_CONTINUATION_HPP
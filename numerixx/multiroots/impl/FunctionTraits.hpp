@@ -54,6 +54,41 @@ namespace nxx::traits
         using return_type   = RES_T;
         using argument_type = PARAM_T;
     };
+
+    /**
+     * @brief Specialization of FunctionTraits for function pointers with an input and an output parameter.
+     *
+     * @details This specialization handles functions that write their results into the second argument,
+     *          such as the callables wrapped by MultiFunctionSystem.
+     *
+     * @tparam RES_T The return type of the function.
+     * @tparam PARAM_T The type of the input argument of the function.
+     * @tparam OUT_T The type of the output argument of the function.
+     */
+    template< typename RES_T, typename PARAM_T, typename OUT_T >
+    struct FunctionTraits< RES_T (*)(PARAM_T, OUT_T) >
+    {
+        using return_type   = RES_T;
+        using argument_type = PARAM_T;
+        using output_type   = OUT_T;
+    };
+
+    /**
+     * @brief Specialization of FunctionTraits for member function pointers (including lambdas)
+     *        with an input and an output parameter.
+     *
+     * @tparam RES_T The return type of the function.
+     * @tparam CLASS_T The class type of the member function.
+     * @tparam PARAM_T The type of the input argument of the function.
+     * @tparam OUT_T The type of the output argument of the function.
+     */
+    template< typename RES_T, typename CLASS_T, typename PARAM_T, typename OUT_T >
+    struct FunctionTraits< RES_T (CLASS_T::*)(PARAM_T, OUT_T) const >
+    {
+        using return_type   = RES_T;
+        using argument_type = PARAM_T;
+        using output_type   = OUT_T;
+    };
 }
 
 #endif    // NUMERIXX_FUNCTIONTRAITS_HPP
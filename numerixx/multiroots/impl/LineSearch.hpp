@@ -0,0 +1,472 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file LineSearch.hpp
+ * @brief This file contains the line searches used for globalizing the multiroot solvers.
+ *
+ * A line search finds a step length alpha along a descent direction d, such that the merit function
+ * phi(alpha) = 0.5 * ||F(x + alpha * d)||^2 is sufficiently reduced. The line searches only interact
+ * with the merit function through a callable object; they are used by MultiNewton (damped Newton) and
+ * SteepestDescent, which provide a MeritFunction caching the trial points and function values.
+ */
+
+#ifndef NUMERIXX_LINESEARCH_HPP
+#define NUMERIXX_LINESEARCH_HPP
+
+#include <Concepts.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <variant>
+
+namespace nxx::multiroots
+{
+    /**
+     * @class ArmijoBacktracking
+     * @brief Backtracking line search, enforcing the Armijo (sufficient decrease) condition.
+     *
+     * @details Starting from the initial step length, the step is reduced until
+     *          phi(alpha) <= phi(0) + c1 * alpha * phi'(0). The reduced step lengths are found by minimizing a quadratic
+     *          (first reduction) or cubic (subsequent reductions) interpolant of the merit values already computed,
+     *          safeguarded to lie in [0.1 * alpha, 0.5 * alpha]. Only function values are required.
+     *
+     * @tparam T The floating point type.
+     */
+    template< IsFloat T >
+    class ArmijoBacktracking
+    {
+        T   m_c1;         /**< The sufficient decrease parameter. */
+        int m_maxiter;    /**< The maximum number of merit function evaluations. */
+
+    public:
+        /**
+         * @brief Constructor.
+         * @param c1 The sufficient decrease parameter.
+         * @param maxiter The maximum number of merit function evaluations.
+         */
+        explicit ArmijoBacktracking(T c1 = 1E-4, int maxiter = 30)
+            : m_c1 { c1 },
+              m_maxiter { maxiter }
+        {}
+
+        /**
+         * @brief Performs the line search.
+         * @param phi The merit function; `phi(alpha)` returns the merit value at step length alpha.
+         * @param phi0 The merit value at alpha = 0.
+         * @param dphi0 The derivative of the merit function at alpha = 0; must be negative.
+         * @param alpha The initial step length.
+         * @return The step length of the last evaluation of `phi`, which is the accepted step length if the
+         *         search succeeded, or the smallest step length tried otherwise.
+         */
+        template< typename PHI_T >
+        T operator()(PHI_T& phi, T phi0, T dphi0, T alpha = 1) const
+        {
+            using std::isfinite;
+            using std::sqrt;
+
+            T alphaPrev {};
+            T phiPrev {};
+
+            for (int iter = 1;; ++iter) {
+                const T value = phi(alpha);
+                if ((isfinite(value) && value <= phi0 + m_c1 * alpha * dphi0) || iter >= m_maxiter) return alpha;
+
+                T next;
+                if (iter == 1 || !isfinite(value))
+                    next = -dphi0 * alpha * alpha / (2 * (value - phi0 - dphi0 * alpha));
+                else {
+                    const T d1    = value - phi0 - dphi0 * alpha;
+                    const T d0    = phiPrev - phi0 - dphi0 * alphaPrev;
+                    const T denom = alphaPrev * alphaPrev * alpha * alpha * (alpha - alphaPrev);
+                    const T a     = (alphaPrev * alphaPrev * d1 - alpha * alpha * d0) / denom;
+                    const T b     = (alpha * alpha * alpha * d0 - alphaPrev * alphaPrev * alphaPrev * d1) / denom;
+                    next          = (a == 0) ? -dphi0 / (2 * b) : (-b + sqrt(b * b - 3 * a * dphi0)) / (3 * a);
+                }
+                if (!isfinite(next)) next = alpha / 2;
+
+                alphaPrev = alpha;
+                phiPrev   = value;
+                alpha     = std::clamp(next, alpha / 10, alpha / 2);
+            }
+        }
+    };
+
+    /**
+     * @class MoreThuente
+     * @brief Line search by Moré and Thuente, enforcing the strong Wolfe conditions.
+     *
+     * @details The step length is found by safeguarded cubic and quadratic interpolation of the merit values and
+     *          derivatives, within an interval of uncertainty that is extrapolated until it brackets a step satisfying
+     *          phi(alpha) <= phi(0) + ftol * alpha * phi'(0) and |phi'(alpha)| <= gtol * |phi'(0)|. The implementation
+     *          follows the MINPACK-2 routines dcsrch and dcstep. In addition to the merit values, the derivative
+     *          phi'(alpha) is required at each trial point.
+     *
+     * @tparam T The floating point type.
+     */
+    template< IsFloat T >
+    class MoreThuente
+    {
+        T   m_ftol;       /**< The sufficient decrease parameter. */
+        T   m_gtol;       /**< The curvature parameter. */
+        T   m_xtol;       /**< The relative tolerance for the width of the interval of uncertainty. */
+        T   m_stpmax;     /**< The upper bound for the step length. */
+        int m_maxiter;    /**< The maximum number of merit function evaluations. */
+
+    public:
+        /**
+         * @brief Constructor.
+         * @param ftol The sufficient decrease parameter.
+         * @param gtol The curvature parameter.
+         * @param maxiter The maximum number of merit function evaluations.
+         * @param stpmax The upper bound for the step length.
+         */
+        explicit MoreThuente(T ftol = 1E-4, T gtol = 0.9, int maxiter = 20, T stpmax = 1E10)
+            : m_ftol { ftol },
+              m_gtol { gtol },
+              m_xtol { 1E-10 },
+              m_stpmax { stpmax },
+              m_maxiter { maxiter }
+        {}
+
+        /**
+         * @brief Performs the line search.
+         * @param phi The merit function; `phi(alpha)` returns the merit value at step length alpha, after which
+         *        `phi.derivative()` returns the derivative at the same step length.
+         * @param phi0 The merit value at alpha = 0.
+         * @param dphi0 The derivative of the merit function at alpha = 0; must be negative.
+         * @param alpha The initial step length.
+         * @return The step length of the last evaluation of `phi`.
+         */
+        template< typename PHI_T >
+        T operator()(PHI_T& phi, T phi0, T dphi0, T alpha = 1) const
+        {
+            using std::abs;
+            using std::isfinite;
+            using std::max;
+            using std::min;
+
+            constexpr T xtrapl = 1.1;
+            constexpr T xtrapu = 4.0;
+
+            const T gtest  = m_ftol * dphi0;
+            T       width  = m_stpmax;
+            T       width1 = 2 * width;
+            bool    brackt = false;
+            bool    stage1 = true;
+
+            // The endpoints of the interval of uncertainty, with the best step so far in stx.
+            T stx = 0, fx = phi0, gx = dphi0;
+            T sty = 0, fy = phi0, gy = dphi0;
+            T stmin = 0, stmax = alpha + xtrapu * alpha;
+
+            for (int iter = 1;; ++iter) {
+                T f = phi(alpha);
+                if (!isfinite(f)) {
+                    // Step into a region where the functions are undefined; retreat towards the best step.
+                    if (iter >= m_maxiter) return alpha;
+                    brackt = true;
+                    sty    = alpha;
+                    fy     = std::numeric_limits< T >::max();
+                    stmin  = min(stx, sty);
+                    stmax  = max(stx, sty);
+                    alpha  = stx + (alpha - stx) / 2;
+                    continue;
+                }
+                const T g     = phi.derivative();
+                const T ftest = phi0 + alpha * gtest;
+
+                if (stage1 && f <= ftest && g >= 0) stage1 = false;
+
+                // Termination: the strong Wolfe conditions are satisfied, or no further progress is possible.
+                if (f <= ftest && abs(g) <= m_gtol * (-dphi0)) return alpha;
+                if (iter >= m_maxiter) return alpha;
+                if (brackt && (alpha <= stmin || alpha >= stmax)) return alpha;
+                if (brackt && stmax - stmin <= m_xtol * stmax) return alpha;
+                if (alpha == m_stpmax && f <= ftest && g <= gtest) return alpha;
+
+                // In the first stage, a modified merit function is used, as long as it has not been shown that the
+                // interval of uncertainty contains a step satisfying the sufficient decrease condition.
+                if (stage1 && f <= fx && f > ftest) {
+                    T fxm = fx - stx * gtest, fym = fy - sty * gtest;
+                    T gxm = gx - gtest, gym = gy - gtest;
+                    step(stx, fxm, gxm, sty, fym, gym, alpha, f - alpha * gtest, g - gtest, brackt, stmin, stmax);
+                    fx = fxm + stx * gtest;
+                    fy = fym + sty * gtest;
+                    gx = gxm + gtest;
+                    gy = gym + gtest;
+                }
+                else
+                    step(stx, fx, gx, sty, fy, gy, alpha, f, g, brackt, stmin, stmax);
+
+                // Force a sufficient decrease of the width of the interval of uncertainty.
+                if (brackt) {
+                    if (abs(sty - stx) >= T { 0.66 } * width1) alpha = stx + (sty - stx) / 2;
+                    width1 = width;
+                    width  = abs(sty - stx);
+                    stmin  = min(stx, sty);
+                    stmax  = max(stx, sty);
+                }
+                else {
+                    stmin = alpha + xtrapl * (alpha - stx);
+                    stmax = alpha + xtrapu * (alpha - stx);
+                }
+
+                alpha = std::clamp(alpha, T {}, m_stpmax);
+                if (brackt && (alpha <= stmin || alpha >= stmax || stmax - stmin <= m_xtol * stmax)) alpha = stx;
+            }
+        }
+
+    private:
+        /**
+         * @brief Computes a safeguarded step, and updates the interval of uncertainty (MINPACK-2 dcstep).
+         * @details On entry, (stx, fx, dx) is the best step so far, (sty, fy, dy) the other endpoint of the interval,
+         *          and (stp, fp, dp) the current step. On exit, stp holds the new trial step.
+         */
+        static void step(T& stx, T& fx, T& dx, T& sty, T& fy, T& dy, T& stp, T fp, T dp, bool& brackt, T stpmin, T stpmax)
+        {
+            using std::abs;
+            using std::max;
+            using std::min;
+            using std::sqrt;
+
+            const T sgnd = dp * (dx / abs(dx));
+            T       stpf;
+
+            // The minimizer of the cubic interpolating (a, fa, da) and (b, fb, db), relative to b.
+            auto gammaOf = [](T theta, T da, T db, T s, bool clampZero) {
+                const T radicand = (theta / s) * (theta / s) - (da / s) * (db / s);
+                return s * sqrt(clampZero ? max(T {}, radicand) : radicand);
+            };
+
+            if (fp > fx) {
+                // Case 1: higher function value; the minimum is bracketed.
+                const T theta = 3 * (fx - fp) / (stp - stx) + dx + dp;
+                const T s     = max({ abs(theta), abs(dx), abs(dp) });
+                T       gamma = gammaOf(theta, dx, dp, s, false);
+                if (stp < stx) gamma = -gamma;
+                const T p    = (gamma - dx) + theta;
+                const T q    = ((gamma - dx) + gamma) + dp;
+                const T stpc = stx + p / q * (stp - stx);
+                const T stpq = stx + ((dx / ((fx - fp) / (stp - stx) + dx)) / 2) * (stp - stx);
+                stpf         = abs(stpc - stx) < abs(stpq - stx) ? stpc : stpc + (stpq - stpc) / 2;
+                brackt       = true;
+            }
+            else if (sgnd < 0) {
+                // Case 2: lower function value and derivatives of opposite sign; the minimum is bracketed.
+                const T theta = 3 * (fx - fp) / (stp - stx) + dx + dp;
+                const T s     = max({ abs(theta), abs(dx), abs(dp) });
+                T       gamma = gammaOf(theta, dx, dp, s, false);
+                if (stp > stx) gamma = -gamma;
+                const T p    = (gamma - dp) + theta;
+                const T q    = ((gamma - dp) + gamma) + dx;
+                const T stpc = stp + p / q * (stx - stp);
+                const T stpq = stp + (dp / (dp - dx)) * (stx - stp);
+                stpf         = abs(stpc - stp) > abs(stpq - stp) ? stpc : stpq;
+                brackt       = true;
+            }
+            else if (abs(dp) < abs(dx)) {
+                // Case 3: lower function value, derivatives of the same sign, and decreasing magnitude of the derivative.
+                const T theta = 3 * (fx - fp) / (stp - stx) + dx + dp;
+                const T s     = max({ abs(theta), abs(dx), abs(dp) });
+                T       gamma = gammaOf(theta, dx, dp, s, true);
+                if (stp > stx) gamma = -gamma;
+                const T p    = (gamma - dp) + theta;
+                const T q    = (gamma + (dx - dp)) + gamma;
+                const T r    = p / q;
+                const T stpc = (r < 0 && gamma != 0) ? stp + r * (stx - stp) : (stp > stx ? stpmax : stpmin);
+                const T stpq = stp + (dp / (dp - dx)) * (stx - stp);
+
+                if (brackt) {
+                    stpf = abs(stpc - stp) < abs(stpq - stp) ? stpc : stpq;
+                    stpf = stp > stx ? min(stp + T { 0.66 } * (sty - stp), stpf) : max(stp + T { 0.66 } * (sty - stp), stpf);
+                }
+                else
+                    stpf = std::clamp(abs(stpc - stp) > abs(stpq - stp) ? stpc : stpq, stpmin, stpmax);
+            }
+            else {
+                // Case 4: lower function value, derivatives of the same sign, and non-decreasing magnitude of the derivative.
+                if (brackt) {
+                    const T theta = 3 * (fp - fy) / (sty - stp) + dy + dp;
+                    const T s     = max({ abs(theta), abs(dy), abs(dp) });
+                    T       gamma = gammaOf(theta, dy, dp, s, false);
+                    if (stp > sty) gamma = -gamma;
+                    const T p = (gamma - dp) + theta;
+                    const T q = ((gamma - dp) + gamma) + dy;
+                    stpf      = stp + p / q * (sty - stp);
+                }
+                else
+                    stpf = stp > stx ? stpmax : stpmin;
+            }
+
+            // Update the interval of uncertainty.
+            if (fp > fx) {
+                sty = stp;
+                fy  = fp;
+                dy  = dp;
+            }
+            else {
+                if (sgnd < 0) {
+                    sty = stx;
+                    fy  = fx;
+                    dy  = dx;
+                }
+                stx = stp;
+                fx  = fp;
+                dx  = dp;
+            }
+            stp = stpf;
+        }
+    };
+
+    /**
+     * @brief A line search used by MultiNewton and SteepestDescent; either ArmijoBacktracking or MoreThuente.
+     */
+    template< IsFloat T >
+    using LineSearch = std::variant< ArmijoBacktracking< T >, MoreThuente< T > >;
+
+    namespace detail
+    {
+        /**
+         * @class MeritFunction
+         * @brief The merit function phi(alpha) = 0.5 * ||F(x + alpha * d)||^2 along a search direction.
+         *
+         * @details The trial point and the function values of the most recent evaluation are cached, so that the
+         *          solver can take them over when the line search has finished, without evaluating the functions
+         *          again. The buffers are reused between iterations of the solver.
+         *
+         * @tparam FUNCTION_T The type of the functions; must be invocable with a `std::span` for the input and output.
+         * @tparam VECTOR_T The vector type used by the solver.
+         */
+        template< typename FUNCTION_T, typename VECTOR_T >
+        class MeritFunction
+        {
+            using T = typename FUNCTION_T::return_type;
+
+            const FUNCTION_T* m_functions {};     /**< The functions of the system. */
+            const VECTOR_T*   m_point {};         /**< The current iterate x. */
+            const VECTOR_T*   m_direction {};     /**< The search direction d. */
+            VECTOR_T          m_trial {};         /**< The most recent trial point. */
+            VECTOR_T          m_values {};        /**< The function values at the most recent trial point. */
+            VECTOR_T          m_perturbed {};     /**< Buffer for the perturbed point used by derivative(). */
+            VECTOR_T          m_fperturbed {};    /**< Buffer for the function values used by derivative(). */
+            T                 m_value {};         /**< The merit value at the most recent trial point. */
+
+            void evaluate(const VECTOR_T& x, VECTOR_T& f) const
+            {
+                (*m_functions)(std::span< const T >(x.data(), x.size()), std::span< T >(f.data(), f.size()));
+            }
+
+            static void resize(VECTOR_T& vector, size_t size)
+            {
+                if constexpr (requires { vector.resize(size); }) vector.resize(size);
+            }
+
+        public:
+            /**
+             * @brief Prepares the merit function for a new line search.
+             * @param functions The functions of the system.
+             * @param point The current iterate x.
+             * @param direction The search direction d.
+             */
+            void reset(const FUNCTION_T& functions, const VECTOR_T& point, const VECTOR_T& direction)
+            {
+                m_functions = &functions;
+                m_point     = &point;
+                m_direction = &direction;
+                for (auto* buffer : { &m_trial, &m_values, &m_perturbed, &m_fperturbed }) resize(*buffer, point.size());
+            }
+
+            /**
+             * @brief Evaluates the merit function at the given step length, caching the trial point and function values.
+             * @param alpha The step length.
+             * @return The merit value.
+             */
+            T operator()(T alpha)
+            {
+                for (size_t i = 0; i < m_trial.size(); ++i) m_trial[i] = (*m_point)[i] + alpha * (*m_direction)[i];
+                evaluate(m_trial, m_values);
+
+                m_value = T {};
+                for (const auto& f : m_values) m_value += f * f;
+                m_value /= 2;
+                return m_value;
+            }
+
+            /**
+             * @brief Computes the derivative of the merit function at the most recent trial point.
+             * @details The derivative F^T * J * d is computed using a forward difference of F along d, which requires
+             *          a single evaluation of the functions.
+             * @return The derivative of the merit function.
+             */
+            T derivative()
+            {
+                using std::max;
+                using std::sqrt;
+
+                T xnorm {};
+                T dnorm {};
+                for (size_t i = 0; i < m_trial.size(); ++i) {
+                    xnorm += m_trial[i] * m_trial[i];
+                    dnorm += (*m_direction)[i] * (*m_direction)[i];
+                }
+                if (dnorm == T {}) return T {};
+                const T h = sqrt(std::numeric_limits< T >::epsilon()) * max(T { 1 }, sqrt(xnorm)) / sqrt(dnorm);
+
+                for (size_t i = 0; i < m_trial.size(); ++i) m_perturbed[i] = m_trial[i] + h * (*m_direction)[i];
+                evaluate(m_perturbed, m_fperturbed);
+
+                T result {};
+                for (size_t i = 0; i < m_values.size(); ++i) result += m_values[i] * (m_fperturbed[i] - m_values[i]);
+                return result / h;
+            }
+
+            /**
+             * @brief The merit value at the most recent trial point.
+             */
+            T value() const { return m_value; }
+
+            /**
+             * @brief The most recent trial point; may be swapped with the solver's iterate.
+             */
+            VECTOR_T& trial() { return m_trial; }
+
+            /**
+             * @brief The function values at the most recent trial point; may be swapped with the solver's function values.
+             */
+            VECTOR_T& values() { return m_values; }
+        };
+    }    // namespace detail
+
+}    // namespace nxx::multiroots
+
+#endif    // NUMERIXX_LINESEARCH_HPP
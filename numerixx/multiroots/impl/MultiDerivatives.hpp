@@ -44,11 +44,22 @@
 // ===== Numerixx Includes
 #include "ContainerTraits.hpp"
 #include "MultiFunctionArray.hpp"
+#include "MultiFunctionSystem.hpp"
+#include "StaticMultiFunction.hpp"
 #include <Deriv.hpp>
 
 // ===== External Includes
 #include "blaze/Blaze.h"
 
+// ===== Standard Library Includes
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
 namespace nxx::deriv
 {
     namespace detail
@@ -65,9 +76,8 @@ namespace nxx::deriv
          * @details
          * Computes the partial derivatives of a multi-variable function at a given point.
          * The function `func` is differentiated with respect to each variable in `point` separately.
-         * The derivative computation is performed using the specified algorithm `ALGO`.
-         *
-         * @note Allocating `singleVarFunc` inside the loop is not optimal and can be improved.
+         * The derivative computation is performed using the specified algorithm `ALGO`. A single copy of the
+         * point is made, in which one coordinate at a time is perturbed (and restored after each evaluation).
          *
          * @throws std::runtime_error If the algorithm fails to compute the derivative.
          */
@@ -78,18 +88,60 @@ namespace nxx::deriv
             using ARG_T  = traits::ContainerValueType_t< CONT_T >;
             static_assert(sizeof(ARG_T) <= sizeof(RET_T), "The precision of the argument types exceeds that of the return type.");
 
+            auto tempPoint = point;
             for (size_t i = 0; i < point.size(); ++i) {
-                // TODO: allocating inside the loop is not optimal
                 auto singleVarFunc = [&, i](ARG_T x) {
-                    auto tempPoint = point;
-                    tempPoint[i]   = x;
-                    return func(std::span< ARG_T >(tempPoint.data(), tempPoint.size()));
+                    tempPoint[i] = x;
+                    auto result  = func(std::span< const ARG_T >(tempPoint.data(), tempPoint.size()));
+                    tempPoint[i] = point[i];
+                    return result;
                 };
 
                 // Compute the derivative using the diff function
                 derivatives[i] = *diff< ALGO >(singleVarFunc, point[i]);
             }
         }
+
+        /**
+         * @brief Computes the Jacobian matrix of a system of equations column by column.
+         *
+         * @param functions The system, which must be invocable as `functions(std::span<const PARAM_T>, std::span<RES_T>)`.
+         * @param args The point of evaluation; one coordinate at a time is perturbed, and restored afterwards.
+         * @param fplus Buffer for the function values at the forward perturbations; one element per function.
+         * @param fminus Buffer for the function values at the backward perturbations; one element per function.
+         * @param J The matrix receiving the Jacobian; must be zero-initialized. The system need not be square.
+         *
+         * @details
+         * Each column is computed using the same 5-point central difference formula (with Richardson extrapolation) as
+         * the `Order1CentralRichardson` algorithm, but perturbing all the functions of the system at once.
+         */
+        template< typename FUNCTION_T, typename ARGS_T, typename VALUES_T, typename MATRIX_T >
+        void jacobianByColumns(const FUNCTION_T& functions, ARGS_T& args, VALUES_T& fplus, VALUES_T& fminus, MATRIX_T& J)
+        {
+            using PARAM_T = std::remove_cvref_t< decltype(args[0]) >;
+            using RES_T   = std::remove_cvref_t< decltype(fplus[0]) >;
+
+            const size_t n        = args.size();
+            const size_t m        = fplus.size();
+            const RES_T  stepsize = StepSize< RES_T >();
+
+            // Adds weight * (f(x + h*e_col) - f(x - h*e_col)) to the given column of J.
+            auto addDifference = [&](size_t col, RES_T h, RES_T weight) {
+                const std::span< const PARAM_T > point(args.data(), n);
+                const PARAM_T                    value = args[col];
+                args[col]                              = value + h;
+                functions(point, std::span< RES_T >(fplus.data(), m));
+                args[col] = value - h;
+                functions(point, std::span< RES_T >(fminus.data(), m));
+                args[col] = value;
+                for (size_t row = 0; row < m; ++row) J(row, col) += weight * (fplus[row] - fminus[row]);
+            };
+
+            for (size_t col = 0; col < n; ++col) {
+                addDifference(col, stepsize, 8 / (12 * stepsize));
+                addDifference(col, 2 * stepsize, -1 / (12 * stepsize));
+            }
+        }
     }    // namespace detail
 
     /**
@@ -337,6 +389,7 @@ namespace nxx::deriv
      *
      * The derivative computation for each function is performed using the specified algorithm `ALGO`. This flexibility allows for
      * the use of different numerical methods to suit the specific requirements of the derivative calculation.
+     * If the function array has an executor (see `MultiFunctionArray::setExecutor`), the rows are computed concurrently.
      *
      * @throws std::runtime_error If the derivative computation algorithm fails.
      */
@@ -350,15 +403,19 @@ namespace nxx::deriv
         // Create a matrix to hold the Jacobian
         blaze::DynamicMatrix< RES_T > J(numRows, numCols);
 
-        // Compute the partial derivatives for each function
-        size_t row = 0;
-        for (const auto& func : functions) {
-            auto partials = partialdiff< ALGO >(func, point);
+        // Compute the partial derivatives for each function. The rows are independent, so they are
+        // distributed over the executor of the function array, if it has one.
+        auto computeRow = [&](size_t row) {
+            auto partials = partialdiff< ALGO >(functions[row], point);
             for (size_t col = 0; col < numCols; ++col) {
                 J(row, col) = partials[col];
             }
-            ++row;
-        }
+        };
+
+        if (auto* pool = functions.executor())
+            pool->parallel_for(numRows, computeRow);
+        else
+            for (size_t row = 0; row < numRows; ++row) computeRow(row);
 
         return J;
     }
@@ -447,6 +504,132 @@ namespace nxx::deriv
         return multidiff< Order1CentralRichardson >(functions, std::vector< RES_T >(point));
     }
 
+    /**
+     * @brief Computes the Jacobian matrix for a system of equations evaluated by a single callable.
+     *
+     * @tparam T The value type of the system.
+     * @tparam FN_T The type of the callable.
+     * @tparam JAC_T The type of the Jacobian callable, or NoJacobian.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param system A `multiroots::MultiFunctionSystem` representing the system of equations.
+     * @param point A container representing the point at which the Jacobian is computed.
+     * @return A `blaze::DynamicMatrix` containing the Jacobian matrix.
+     *
+     * @details
+     * The Jacobian is computed column by column, using the same 5-point central difference formula (with Richardson
+     * extrapolation) as the `Order1CentralRichardson` algorithm, but perturbing all the functions of the system at
+     * once. Hence, the full Jacobian requires 4*N evaluations of the system, rather than 4*N^2 evaluations of the
+     * individual functions. The perturbed points and the function values are kept in buffers that are allocated
+     * once, and reused for all columns.
+     *
+     * If the system carries a Jacobian callable, the Jacobian is computed by that instead, without finite differences.
+     */
+    template< typename T, typename FN_T, typename JAC_T, typename CONTAINER_T >
+    blaze::DynamicMatrix< T > jacobian(const multiroots::MultiFunctionSystem< T, FN_T, JAC_T >& system, const CONTAINER_T& point)
+    {
+        const size_t n = point.size();
+
+        blaze::DynamicMatrix< T > J(n, n, T {});
+        std::vector< T >          args(point.begin(), point.end());
+
+        if constexpr (multiroots::MultiFunctionSystem< T, FN_T, JAC_T >::has_jacobian)
+            system.jacobian(std::span< const T >(args.data(), n), J);
+        else {
+            std::vector< T > fplus(n);
+            std::vector< T > fminus(n);
+            detail::jacobianByColumns(system, args, fplus, fminus, J);
+        }
+        return J;
+    }
+
+    /**
+     * @brief Computes the Jacobian matrix for a system of equations with a size known at compile time.
+     *
+     * @tparam FUNCTION_T The type of the wrapped functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam N The number of unknowns of the system.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param functions A `multiroots::StaticMultiFunction` representing the system of equations.
+     * @param point A container representing the point at which the Jacobian is computed.
+     * @return A `blaze::StaticMatrix` containing the Jacobian matrix.
+     *
+     * @details
+     * The Jacobian is computed column by column, in the same way as for a `MultiFunctionSystem`, but the matrix and
+     * all the buffers are fixed-size Blaze types. Hence, no memory is allocated on the heap. If the system carries a
+     * Jacobian callable, the Jacobian is computed by that instead; a fused callable writes its function values into
+     * one of the fixed-size buffers.
+     */
+    template< typename FUNCTION_T, size_t N, typename CONTAINER_T >
+    blaze::StaticMatrix< typename FUNCTION_T::return_type, N, N >
+        jacobian(const multiroots::StaticMultiFunction< FUNCTION_T, N >& functions, const CONTAINER_T& point)
+    {
+        using RES_T   = typename FUNCTION_T::return_type;
+        using PARAM_T = typename FUNCTION_T::param_type;
+
+        blaze::StaticMatrix< RES_T, N, N > J {};
+        blaze::StaticVector< PARAM_T, N >  args {};
+        blaze::StaticVector< RES_T, N >    fplus {};
+        blaze::StaticVector< RES_T, N >    fminus {};
+
+        std::copy(point.begin(), point.end(), args.begin());
+        if constexpr (multiroots::HasJacobian< FUNCTION_T >)
+            functions.jacobian(std::span< const PARAM_T >(args.data(), N), J, std::span< RES_T >(fplus.data(), N));
+        else
+            detail::jacobianByColumns(functions, args, fplus, fminus, J);
+        return J;
+    }
+
+    /**
+     * @brief Computes the exact Jacobian matrix for a set of generic multi-variable functions, using forward automatic differentiation.
+     *
+     * @tparam ALGO The automatic differentiation tag (e.g. `AutoDiff` or `AutoDiffLanes<N>`).
+     * @tparam FUNCS_T The types of the functions.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param functions A `std::tuple` holding the functions. Each function must be a generic callable taking a
+     *        `std::span` of the argument type, such that it can be instantiated with `Dual` numbers.
+     * @param point A container representing the point at which the Jacobian is computed.
+     * @return A `blaze::DynamicMatrix` containing the Jacobian matrix.
+     *
+     * @details
+     * The functions are evaluated with `Dual<T, Lanes>` arguments, where the tangents of `Lanes` of the arguments
+     * are seeded with unit vectors. Hence, each sweep over the functions yields `Lanes` columns of the Jacobian,
+     * and the full Jacobian is computed in ceil(N / Lanes) sweeps. Unlike the finite difference based `jacobian`
+     * function, the derivatives are exact to machine precision.
+     *
+     * As a `multiroots::MultiFunctionArray` stores type-erased functions of floating point arguments, the
+     * functions must be provided as a tuple of the original (generic) callables.
+     */
+    template< typename ALGO, typename... FUNCS_T, typename CONTAINER_T >
+    requires ALGO::IsAutoDiff && nxx::IsFloat< traits::ContainerValueType_t< CONTAINER_T > >
+    auto jacobian(const std::tuple< FUNCS_T... >& functions, const CONTAINER_T& point)
+    {
+        using ARG_T  = traits::ContainerValueType_t< CONTAINER_T >;
+        using DUAL_T = Dual< ARG_T, ALGO::Lanes >;
+
+        const size_t numCols = point.size();
+
+        blaze::DynamicMatrix< ARG_T > J(sizeof...(FUNCS_T), numCols);
+        std::vector< DUAL_T >         args(point.begin(), point.end());
+
+        // Each sweep seeds the tangents of (at most) ALGO::Lanes arguments, and yields the corresponding columns of J.
+        for (size_t offset = 0; offset < numCols; offset += ALGO::Lanes) {
+            const size_t lanes = std::min(ALGO::Lanes, numCols - offset);
+            for (size_t lane = 0; lane < lanes; ++lane) args[offset + lane] = DUAL_T::variable(point[offset + lane], lane);
+
+            size_t row      = 0;
+            auto   storeRow = [&](const DUAL_T& result) {
+                for (size_t lane = 0; lane < lanes; ++lane) J(row, offset + lane) = result.tangent(lane);
+                ++row;
+            };
+
+            const std::span< DUAL_T > span(args.data(), args.size());
+            std::apply([&](const auto&... func) { (storeRow(func(span)), ...); }, functions);
+
+            for (size_t lane = 0; lane < lanes; ++lane) args[offset + lane] = DUAL_T(point[offset + lane]);
+        }
+
+        return J;
+    }
+
     /**
      * @brief Computes the Hessian matrix for a set of multi-variable functions.
      *
@@ -503,6 +686,302 @@ namespace nxx::deriv
         return multidiff< Order2Central5Point >(functions, std::vector< RES_T >(point));
     }
 
+    namespace detail
+    {
+        /**
+         * @brief Computes the finite difference step size for a directional derivative.
+         *
+         * @tparam CONT_T The container type of the point and the direction.
+         * @param point A container representing the point at which the directional derivative is computed.
+         * @param direction A container representing the direction of differentiation.
+         * @return The step size, or zero if the direction is a zero vector.
+         *
+         * @details
+         * The step size is scaled by the ratio of the norm of the point to the norm of the direction, i.e.
+         * h = sqrt(eps) * max(1, ||x||) / ||v||. This ensures that the perturbation x + h*v is of the same
+         * relative magnitude as x, regardless of the scaling of v.
+         */
+        template< typename CONT_T >
+        auto directionalStepSize(const CONT_T& point, const CONT_T& direction)
+        {
+            using ARG_T = traits::ContainerValueType_t< CONT_T >;
+            using std::max;
+            using std::sqrt;
+
+            const ARG_T xnorm = sqrt(std::inner_product(point.begin(), point.end(), point.begin(), ARG_T {}));
+            const ARG_T vnorm = sqrt(std::inner_product(direction.begin(), direction.end(), direction.begin(), ARG_T {}));
+
+            if (vnorm == ARG_T {}) return ARG_T {};
+            return sqrt(std::numeric_limits< ARG_T >::epsilon()) * max(ARG_T { 1.0 }, xnorm) / vnorm;
+        }
+
+        /**
+         * @brief Computes the perturbed point x + h*v.
+         *
+         * @tparam CONT_T The container type of the point and the direction.
+         * @param point The point x.
+         * @param direction The direction v.
+         * @param stepsize The step size h.
+         * @return A container of the same type as `point`, holding x + h*v.
+         */
+        template< typename CONT_T >
+        CONT_T perturbedPoint(const CONT_T& point, const CONT_T& direction, traits::ContainerValueType_t< CONT_T > stepsize)
+        {
+            CONT_T result(point);
+            for (size_t i = 0; i < result.size(); ++i) result[i] += stepsize * direction[i];
+            return result;
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Computes the product of the Jacobian matrix and a vector, without forming the Jacobian.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a `multiroots::MultiFunctionArray` or a `multiroots::MultiFunctionSystem`.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param functions An object representing the set of functions.
+     * @param point A container representing the point x at which the product is computed.
+     * @param direction A container representing the vector v.
+     * @param fpoint The function values F(x) at `point`, typically cached by the caller.
+     * @return A `blaze::DynamicVector` containing the approximation of J(x)*v.
+     *
+     * @details
+     * This function approximates the directional derivative J(x)*v using a forward difference along v:
+     * (F(x + h*v) - F(x)) / h. The step size h is scaled by ||x||/||v||, so the product is well-conditioned
+     * regardless of the magnitude of v. As F(x) is provided by the caller, only a single evaluation of the
+     * function array is required, as opposed to the 4*N^2 evaluations required for forming the full Jacobian.
+     *
+     * This is the basic building block for matrix-free (e.g. Krylov subspace) methods and line searches.
+     */
+    template< typename FUNCTION_T, typename CONTAINER_T, typename RES_T = typename FUNCTION_T::return_type >
+    blaze::DynamicVector< RES_T > jvp(const FUNCTION_T&                    functions,
+                                      const CONTAINER_T&                   point,
+                                      const CONTAINER_T&                   direction,
+                                      const blaze::DynamicVector< RES_T >& fpoint)
+    {
+        const auto h = detail::directionalStepSize(point, direction);
+        if (h == decltype(h) {}) return blaze::DynamicVector< RES_T >(fpoint.size(), RES_T {});
+
+        blaze::DynamicVector< RES_T > result = functions.template eval< blaze::DynamicVector >(detail::perturbedPoint(point, direction, h));
+        for (size_t i = 0; i < result.size(); ++i) result[i] = (result[i] - fpoint[i]) / h;
+
+        return result;
+    }
+
+    /**
+     * @brief Computes the product of the Jacobian matrix and a vector, for a system with an analytic Jacobian.
+     *
+     * @tparam FUNCTION_T The type of the system, carrying a Jacobian callable (see `multiroots::HasJacobian`).
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param functions An object representing the system of equations.
+     * @param point A container representing the point x at which the product is computed.
+     * @param direction A container representing the vector v.
+     * @param fpoint The function values F(x) at `point`; not used, as no finite difference is taken.
+     * @return A `blaze::DynamicVector` containing J(x)*v.
+     *
+     * @details
+     * The Jacobian is computed by the Jacobian callable of the system, and multiplied by v. Hence, the product is
+     * exact, but each call forms the full Jacobian; callers needing several products at the same point (e.g.
+     * Krylov solvers) should compute the Jacobian once instead.
+     */
+    template< typename FUNCTION_T, typename CONTAINER_T, typename RES_T = typename FUNCTION_T::return_type >
+    requires multiroots::HasJacobian< FUNCTION_T >
+    blaze::DynamicVector< RES_T > jvp(const FUNCTION_T&                    functions,
+                                      const CONTAINER_T&                   point,
+                                      const CONTAINER_T&                   direction,
+                                      const blaze::DynamicVector< RES_T >& fpoint)
+    {
+        const auto J = jacobian(functions, point);
+
+        blaze::DynamicVector< RES_T > result(fpoint.size(), RES_T {});
+        for (size_t i = 0; i < result.size(); ++i)
+            for (size_t j = 0; j < direction.size(); ++j) result[i] += J(i, j) * direction[j];
+
+        return result;
+    }
+
+    /**
+     * @brief Computes the product of the Jacobian matrix and a vector, without forming the Jacobian.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a `multiroots::MultiFunctionArray` or a `multiroots::MultiFunctionSystem`.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param functions An object representing the set of functions.
+     * @param point A container representing the point x at which the product is computed.
+     * @param direction A container representing the vector v.
+     * @return A `blaze::DynamicVector` containing the approximation of J(x)*v.
+     *
+     * @details
+     * This overload evaluates F(x) before delegating to the overload taking the cached function values.
+     * Hence, it requires two evaluations of the function array. When the function values at `point`
+     * are already known, the overload taking F(x) as an argument should be preferred.
+     */
+    template< typename FUNCTION_T, typename CONTAINER_T, typename RES_T = typename FUNCTION_T::return_type >
+    blaze::DynamicVector< RES_T > jvp(const FUNCTION_T& functions, const CONTAINER_T& point, const CONTAINER_T& direction)
+    {
+        return jvp(functions, point, direction, functions.template eval< blaze::DynamicVector >(point));
+    }
+
+    /**
+     * @brief Computes the product of the gradient of a multi-variable function and a vector.
+     *
+     * @tparam FUNC_T The type of the function; must be invocable with a `std::span` of the argument type.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param func The function (e.g. a `multiroots::MultiFunction` or a lambda taking a `std::span`).
+     * @param point A container representing the point x at which the product is computed.
+     * @param direction A container representing the vector v.
+     * @param fpoint The function value f(x) at `point`, typically cached by the caller.
+     * @return The approximation of grad(f(x)) * v.
+     *
+     * @details
+     * This function approximates the directional derivative of a scalar function using a forward difference
+     * along v, i.e. (f(x + h*v) - f(x)) / h, where the step size h is scaled by ||x||/||v||. It requires a single
+     * function evaluation, as f(x) is provided by the caller.
+     */
+    template< typename FUNC_T, typename CONTAINER_T >
+    requires IsSpanInvocable< FUNC_T >
+    auto gradient_dot(const FUNC_T&                               func,
+                      const CONTAINER_T&                          point,
+                      const CONTAINER_T&                          direction,
+                      traits::ContainerValueType_t< CONTAINER_T > fpoint)
+    {
+        using ARG_T = traits::ContainerValueType_t< CONTAINER_T >;
+
+        const auto h = detail::directionalStepSize(point, direction);
+        if (h == ARG_T {}) return ARG_T {};
+
+        auto perturbed = detail::perturbedPoint(point, direction, h);
+        return static_cast< ARG_T >((func(std::span< ARG_T >(perturbed.data(), perturbed.size())) - fpoint) / h);
+    }
+
+    /**
+     * @brief Computes the product of the gradient of a multi-variable function and a vector.
+     *
+     * @tparam FUNC_T The type of the function; must be invocable with a `std::span` of the argument type.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param func The function (e.g. a `multiroots::MultiFunction` or a lambda taking a `std::span`).
+     * @param point A container representing the point x at which the product is computed.
+     * @param direction A container representing the vector v.
+     * @return The approximation of grad(f(x)) * v.
+     *
+     * @details
+     * This overload evaluates f(x) before delegating to the overload taking the cached function value.
+     */
+    template< typename FUNC_T, typename CONTAINER_T >
+    requires IsSpanInvocable< FUNC_T >
+    auto gradient_dot(const FUNC_T& func, const CONTAINER_T& point, const CONTAINER_T& direction)
+    {
+        using ARG_T = traits::ContainerValueType_t< CONTAINER_T >;
+
+        auto copy = point;
+        return gradient_dot(func, point, direction, static_cast< ARG_T >(func(std::span< ARG_T >(copy.data(), copy.size()))));
+    }
+
+    /**
+     * @brief Computes the gradient of a scalar multi-variable function, using reverse-mode automatic differentiation.
+     *
+     * @tparam ALGO The differentiation algorithm; must be `ReverseAD`.
+     * @tparam FUNC_T The type of the function; must be a generic callable, taking a `std::span` of `Var` objects.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param func The function to differentiate.
+     * @param point A container representing the point at which the gradient is computed.
+     * @param grad The buffer receiving the gradient; must hold (at least) one element per argument.
+     * @param tape The tape to record the computation on.
+     *
+     * @details
+     * The function is evaluated once with active arguments, recording the computation on the tape, after which a single
+     * reverse sweep yields all partial derivatives. The cost is a small constant multiple of one function evaluation,
+     * independent of the number of arguments. The arguments are created in a buffer owned by the tape, and the tape is
+     * rewound to its initial position before returning (also if the function throws), so once the tape has grown to
+     * the size of the computation, subsequent calls run without any heap allocation.
+     */
+    template< typename ALGO, typename FUNC_T, typename CONTAINER_T >
+    requires ALGO::IsReverseAD && nxx::IsFloat< traits::ContainerValueType_t< CONTAINER_T > >
+    void gradient(const FUNC_T&                                            func,
+                  const CONTAINER_T&                                       point,
+                  std::span< traits::ContainerValueType_t< CONTAINER_T > > grad,
+                  Tape< traits::ContainerValueType_t< CONTAINER_T > >&     tape)
+    {
+        using ARG_T = traits::ContainerValueType_t< CONTAINER_T >;
+
+        // Rewinds the tape on exit, also if the function throws.
+        struct Rewind
+        {
+            Tape< ARG_T >&                     tape;
+            typename Tape< ARG_T >::Checkpoint checkpoint;
+            ~Rewind() { tape.rewind(checkpoint); }
+        } rewind { tape, tape.checkpoint() };
+
+        const auto         args   = tape.variables(point);
+        const Var< ARG_T > result = func(args);
+        tape.backward(result);
+
+        for (size_t i = 0; i < args.size(); ++i) grad[i] = tape.adjoint(args[i]);
+    }
+
+    /**
+     * @brief Computes the gradient of a scalar multi-variable function, using reverse-mode automatic differentiation.
+     *
+     * @tparam ALGO The differentiation algorithm; must be `ReverseAD`.
+     * @tparam FUNC_T The type of the function; must be a generic callable, taking a `std::span` of `Var` objects.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param func The function to differentiate.
+     * @param point A container representing the point at which the gradient is computed.
+     * @param grad The buffer receiving the gradient; must hold (at least) one element per argument.
+     *
+     * @details
+     * This overload records the computation on the thread-local default tape, which is reused across calls.
+     */
+    template< typename ALGO, typename FUNC_T, typename CONTAINER_T >
+    requires ALGO::IsReverseAD && nxx::IsFloat< traits::ContainerValueType_t< CONTAINER_T > >
+    void gradient(const FUNC_T& func, const CONTAINER_T& point, std::span< traits::ContainerValueType_t< CONTAINER_T > > grad)
+    {
+        gradient< ALGO >(func, point, grad, defaultTape< traits::ContainerValueType_t< CONTAINER_T > >());
+    }
+
+    /**
+     * @brief Computes the gradient of a scalar multi-variable function, using reverse-mode automatic differentiation.
+     *
+     * @tparam ALGO The differentiation algorithm; must be `ReverseAD`.
+     * @tparam FUNC_T The type of the function; must be a generic callable, taking a `std::span` of `Var` objects.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param func The function to differentiate.
+     * @param point A container representing the point at which the gradient is computed.
+     * @param tape The tape to record the computation on.
+     * @return A `blaze::DynamicVector` containing the gradient at `point`.
+     *
+     * @details
+     * This overload allocates the returned vector; use the overload taking a buffer to avoid that.
+     */
+    template< typename ALGO, typename FUNC_T, typename CONTAINER_T >
+    requires ALGO::IsReverseAD && nxx::IsFloat< traits::ContainerValueType_t< CONTAINER_T > >
+    auto gradient(const FUNC_T& func, const CONTAINER_T& point, Tape< traits::ContainerValueType_t< CONTAINER_T > >& tape)
+    {
+        using ARG_T = traits::ContainerValueType_t< CONTAINER_T >;
+
+        blaze::DynamicVector< ARG_T > grad(std::size(point));
+        gradient< ALGO >(func, point, std::span< ARG_T >(grad.data(), grad.size()), tape);
+        return grad;
+    }
+
+    /**
+     * @brief Computes the gradient of a scalar multi-variable function, using reverse-mode automatic differentiation.
+     *
+     * @tparam ALGO The differentiation algorithm; must be `ReverseAD`.
+     * @tparam FUNC_T The type of the function; must be a generic callable, taking a `std::span` of `Var` objects.
+     * @tparam CONTAINER_T The container type for the function arguments.
+     * @param func The function to differentiate.
+     * @param point A container representing the point at which the gradient is computed.
+     * @return A `blaze::DynamicVector` containing the gradient at `point`.
+     *
+     * @details
+     * This overload records the computation on the thread-local default tape, which is reused across calls.
+     */
+    template< typename ALGO, typename FUNC_T, typename CONTAINER_T >
+    requires ALGO::IsReverseAD && nxx::IsFloat< traits::ContainerValueType_t< CONTAINER_T > >
+    auto gradient(const FUNC_T& func, const CONTAINER_T& point)
+    {
+        return gradient< ALGO >(func, point, defaultTape< traits::ContainerValueType_t< CONTAINER_T > >());
+    }
+
 }    // namespace nxx::deriv
 
 #endif    // NUMERIXX_MULTIDERIVATIVES_HPP
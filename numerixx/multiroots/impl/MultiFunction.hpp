@@ -10,13 +10,172 @@
 #include <Concepts.hpp>
 
 #include <algorithm>
-#include <functional>
+#include <array>
+#include <cstddef>
 #include <initializer_list>
+#include <new>
 #include <span>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace nxx::multiroots
 {
+    namespace detail
+    {
+        /**
+         * @brief A copyable, type-erased wrapper for callables taking a span of arguments, with a small buffer optimization.
+         *
+         * @details Unlike std::function, the wrapper is specialized for the signature RES_T(std::span<const T>), and
+         *          callables of up to BufferSize bytes (e.g. lambdas capturing a few values) are stored inline, so that
+         *          neither construction, copying nor invocation allocates. Larger callables are stored on the heap.
+         *          Callables taking a std::span<const T> are invoked with a view of the caller's data. Callables taking
+         *          a mutable std::span<T> are given a copy of the arguments, on the stack for up to 16 arguments, so
+         *          that they cannot modify the caller's data; declare the parameter as std::span<const T> to avoid it.
+         *
+         * @tparam RES_T The return type of the callable.
+         * @tparam T The value type of the arguments.
+         */
+        template< typename RES_T, typename T >
+        class SpanFunction
+        {
+            static constexpr size_t BufferSize = 4 * sizeof(void*);
+            static constexpr size_t StackSize  = 16; /**< The number of arguments copied on the stack for mutable-span callables. */
+
+            template< typename FN >
+            static constexpr bool IsInline =
+                sizeof(FN) <= BufferSize && alignof(FN) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v< FN >;
+
+            struct Operations
+            {
+                RES_T (*invoke)(const void*, std::span< const T >);
+                void (*copy)(const void*, void*);
+                void (*move)(void*, void*);
+                void (*destroy)(void*);
+            };
+
+            template< typename FN >
+            static const FN* target(const void* storage)
+            {
+                if constexpr (IsInline< FN >)
+                    return std::launder(static_cast< const FN* >(storage));
+                else
+                    return *std::launder(static_cast< FN* const* >(storage));
+            }
+
+            template< typename FN >
+            static constexpr Operations OperationsFor {
+                [](const void* storage, std::span< const T > args) -> RES_T {
+                    const FN& function = *target< FN >(storage);
+                    if constexpr (std::is_invocable_v< const FN&, std::span< const T > >)
+                        return function(args);
+                    else {
+                        // The callable may modify its arguments, so it is given a copy rather than the caller's data.
+                        if (args.size() <= StackSize) {
+                            std::array< T, StackSize > buffer;
+                            std::copy(args.begin(), args.end(), buffer.begin());
+                            return function(std::span< T >(buffer.data(), args.size()));
+                        }
+
+                        std::vector< T > buffer(args.begin(), args.end());
+                        return function(std::span< T >(buffer.data(), buffer.size()));
+                    }
+                },
+                [](const void* source, void* destination) {
+                    if constexpr (IsInline< FN >)
+                        ::new (destination) FN(*target< FN >(source));
+                    else
+                        ::new (destination) FN*(new FN(*target< FN >(source)));
+                },
+                [](void* source, void* destination) {
+                    if constexpr (IsInline< FN >) {
+                        FN* function = std::launder(static_cast< FN* >(source));
+                        ::new (destination) FN(std::move(*function));
+                        function->~FN();
+                    }
+                    else
+                        ::new (destination) FN*(*std::launder(static_cast< FN** >(source)));
+                },
+                [](void* storage) {
+                    if constexpr (IsInline< FN >)
+                        std::launder(static_cast< FN* >(storage))->~FN();
+                    else
+                        delete *std::launder(static_cast< FN** >(storage));
+                }
+            };
+
+            alignas(std::max_align_t) std::byte m_storage[BufferSize]; /**< Storage for the callable, or a pointer to it. */
+            const Operations* m_operations = nullptr;                  /**< The operations for the stored callable. */
+
+        public:
+            SpanFunction() = default;
+
+            /**
+             * @brief Constructs a SpanFunction object holding a copy of the given callable.
+             * @param function The callable.
+             */
+            template< typename FN >
+            requires(!std::is_same_v< std::decay_t< FN >, SpanFunction >)
+            SpanFunction(FN&& function)
+            {
+                using CALLABLE_T = std::decay_t< FN >;
+                if constexpr (IsInline< CALLABLE_T >)
+                    ::new (static_cast< void* >(m_storage)) CALLABLE_T(std::forward< FN >(function));
+                else
+                    ::new (static_cast< void* >(m_storage)) CALLABLE_T*(new CALLABLE_T(std::forward< FN >(function)));
+                m_operations = &OperationsFor< CALLABLE_T >;
+            }
+
+            SpanFunction(const SpanFunction& other)
+                : m_operations { other.m_operations }
+            {
+                if (m_operations) m_operations->copy(other.m_storage, m_storage);
+            }
+
+            SpanFunction(SpanFunction&& other) noexcept
+                : m_operations { std::exchange(other.m_operations, nullptr) }
+            {
+                if (m_operations) m_operations->move(other.m_storage, m_storage);
+            }
+
+            SpanFunction& operator=(const SpanFunction& other)
+            {
+                if (this != &other) *this = SpanFunction(other);
+                return *this;
+            }
+
+            SpanFunction& operator=(SpanFunction&& other) noexcept
+            {
+                if (this != &other) {
+                    reset();
+                    m_operations = std::exchange(other.m_operations, nullptr);
+                    if (m_operations) m_operations->move(other.m_storage, m_storage);
+                }
+                return *this;
+            }
+
+            ~SpanFunction() { reset(); }
+
+            /**
+             * @brief Invokes the stored callable.
+             * @param args A view of the arguments.
+             * @return The return value of the callable.
+             */
+            RES_T operator()(std::span< const T > args) const { return m_operations->invoke(m_storage, args); }
+
+            /**
+             * @brief Checks whether a callable is stored.
+             */
+            explicit operator bool() const { return m_operations != nullptr; }
+
+        private:
+            void reset()
+            {
+                if (m_operations) m_operations->destroy(m_storage);
+                m_operations = nullptr;
+            }
+        };
+    }    // namespace detail
 
     /**
      * @brief A class template to encapsulate a multi-dimensional function for root finding.
@@ -34,7 +193,8 @@ namespace nxx::multiroots
     class MultiFunction
     {
     public:
-        using FUNC_T = std::function< RES_T(std::span< PARAM_T >) >;    ///< Type of the encapsulated function.
+        using ELEM_T = std::remove_cvref_t< PARAM_T >;               ///< Type of the elements of the arguments.
+        using FUNC_T = detail::SpanFunction< RES_T, ELEM_T >;    ///< Type of the encapsulated function.
 
         /**
          * @brief Constructs a MultiFunction object with a given callable.
@@ -50,7 +210,7 @@ namespace nxx::multiroots
             (std::is_same_v< typename traits::FunctionTraits< CALLABLE_T >::argument_type, std::span< std::remove_cvref_t< PARAM_T > > > ||
              std::is_same_v< typename traits::FunctionTraits< CALLABLE_T >::argument_type, std::span< const std::remove_cvref_t< PARAM_T > > >))
         MultiFunction(CALLABLE_T f)
-            : function(f)
+            : function(std::move(f))
         {}
 
         MultiFunction(const MultiFunction&) = default;
@@ -58,65 +218,43 @@ namespace nxx::multiroots
         MultiFunction& operator=(const MultiFunction&) = default;
         MultiFunction& operator=(MultiFunction&&) = default;
 
-
         /**
-         * @brief Invokes the function using a std::initializer_list, specifically for const U types.
+         * @brief Invokes the function with a view of the arguments.
          *
-         * @details This operator allows the function to be called with an initializer list.
-         *          It is enabled only when U is a const type. The initializer list is converted
-         *          to a std::span before invoking the encapsulated function.
+         * @details This is the primary entry point; the arguments are passed on to the encapsulated function
+         *          without copying, and no memory is allocated, if it takes a std::span<const T>. A function taking
+         *          a mutable std::span<T> is given a copy of the arguments (see detail::SpanFunction).
          *
-         * @param  list An initializer list of elements of type U.
+         * @param  args A view of the arguments.
          * @return The return value of the encapsulated function.
          */
-        RES_T operator()(std::initializer_list< PARAM_T > list) const requires std::is_const_v< PARAM_T >
-        {
-            std::span< PARAM_T > span(data(list), list.size());
-            return function(span);
-        }
+        RES_T operator()(std::span< const ELEM_T > args) const { return function(args); }
 
         /**
-         * @brief Invokes the function using a std::initializer_list, specifically for non-const U types.
-         *
-         * @details This operator allows the function to be called with an initializer list.
-         *          It is enabled only when U is a non-const type. The initializer list is first
-         *          converted to a std::vector, then to a std::span, before invoking the encapsulated function.
+         * @brief Invokes the function using a std::initializer_list.
          *
-         * @param  list An initializer list of elements of type U.
+         * @param  list An initializer list of arguments.
          * @return The return value of the encapsulated function.
          */
-        RES_T operator()(std::initializer_list< PARAM_T > list) const requires(!std::is_const_v< PARAM_T >)
-        {
-            std::vector< PARAM_T > tempVec(list);    // Create a temporary vector from the initializer list
-            std::span< PARAM_T >   span(tempVec.data(), tempVec.size());
-            return function(span);
-        }
+        RES_T operator()(std::initializer_list< ELEM_T > list) const { return function(std::span< const ELEM_T >(list.begin(), list.size())); }
 
         /**
          * @brief Invokes the function using a container, where the container's value type matches U.
          *
          * @details This operator allows the function to be called with a container,
          *          provided the container's value type exactly matches U (after removing cv-ref qualifiers).
-         *          It converts the container to a std::span before invoking the function.
-         *          If U is a const type, the container is used directly. Otherwise, a copy is made.
+         *          The container must store its elements contiguously; it is passed to the function as a
+         *          std::span, without copying unless the function takes a mutable std::span.
          *
          * @tparam CONTAINER_T The type of the input container.
          * @param  container The container holding elements of type U.
          * @return The return value of the encapsulated function.
          */
         template< typename CONTAINER_T >
-        requires std::is_same_v< std::remove_cvref_t< PARAM_T >, traits::ContainerValueType_t< CONTAINER_T > >
+        requires std::is_same_v< ELEM_T, traits::ContainerValueType_t< CONTAINER_T > >
         RES_T operator()(const CONTAINER_T& container) const
         {
-            if constexpr (std::is_const_v< PARAM_T >) {
-                std::span< PARAM_T > span(container.data(), container.size());
-                return function(span);
-            }
-            else {
-                CONTAINER_T    tempVec(container);    // Create a temporary vector from the container
-                std::span< PARAM_T > span(tempVec.data(), tempVec.size());
-                return function(span);
-            }
+            return function(std::span< const ELEM_T >(std::data(container), std::size(container)));
         }
 
         /**
@@ -124,23 +262,30 @@ namespace nxx::multiroots
          *
          * @details This operator allows the function to be called with a container,
          *          provided the container's value type is convertible to U, and not exactly U.
-         *          It creates a temporary std::vector of U, copies and converts the elements
-         *          of the container into it, and then uses this vector to invoke the function.
+         *          The elements are converted into a buffer on the stack or, for large containers, on the heap,
+         *          which is then used to invoke the function.
          *
          * @tparam CONTAINER_T The type of the input container.
          * @param  container The container holding elements convertible to U.
          * @return The return value of the encapsulated function.
          */
         template< typename CONTAINER_T >
-        requires std::convertible_to< traits::ContainerValueType_t< CONTAINER_T >, std::remove_cvref_t< PARAM_T > > &&
-                 (!std::is_same_v< std::remove_cvref_t< PARAM_T >, traits::ContainerValueType_t< CONTAINER_T > >)
+        requires std::convertible_to< traits::ContainerValueType_t< CONTAINER_T >, ELEM_T > &&
+                 (!std::is_same_v< ELEM_T, traits::ContainerValueType_t< CONTAINER_T > >)
         RES_T operator()(const CONTAINER_T& container) const
         {
-            std::vector< PARAM_T > tempVec(container.size());    // Create a temporary vector from the container
-            std::transform(container.begin(), container.end(), tempVec.begin(), [](float value) { return static_cast< double >(value); });
+            constexpr size_t StackSize = 16;
+            const auto       convert   = [](const auto& value) { return static_cast< ELEM_T >(value); };
+
+            if (container.size() <= StackSize) {
+                std::array< ELEM_T, StackSize > buffer;
+                std::transform(container.begin(), container.end(), buffer.begin(), convert);
+                return function(std::span< const ELEM_T >(buffer.data(), container.size()));
+            }
 
-            std::span< PARAM_T > span(tempVec.data(), tempVec.size());
-            return function(span);
+            std::vector< ELEM_T > buffer(container.size());
+            std::transform(container.begin(), container.end(), buffer.begin(), convert);
+            return function(std::span< const ELEM_T >(buffer.data(), buffer.size()));
         }
 
     private:
@@ -41,12 +41,19 @@
 #ifndef NUMERIXX_MULTIFUNCTIONARRAY_HPP
 #define NUMERIXX_MULTIFUNCTIONARRAY_HPP
 
+#include <atomic>
+#include <chrono>
 #include <concepts>
+#include <cstdint>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
 #include <Concepts.hpp>
+#include <ThreadPool.hpp>
 
 namespace nxx::multiroots
 {
@@ -63,6 +70,8 @@ namespace nxx::multiroots
     public:
         using FUNC_T         = MultiFunction< RET_T, PARAM_T >;                   ///< Alias for function type.
         using const_iterator = typename std::vector< FUNC_T >::const_iterator;    ///< Iterator type.
+        using return_type    = RET_T;                                             ///< Alias for the return type of the functions.
+        using param_type     = PARAM_T;                                           ///< Alias for the parameter type of the functions.
 
         /**
          * @brief Default constructor for MultiFunctionArray.
@@ -121,6 +130,46 @@ namespace nxx::multiroots
             functions.push_back(FUNC_T(func));
         }
 
+        /**
+         * @brief Applies all functions to a view of the input, writing the results into preallocated storage.
+         * @details Neither the input nor the results are copied, and no memory is allocated.
+         * @param input A view of the input values.
+         * @param output The storage for the results; must hold (at least) one element per function.
+         */
+        void operator()(std::span< const PARAM_T > input, std::span< RET_T > output) const
+        {
+            dispatch([&](size_t i) { output[i] = functions[i](input); });
+        }
+
+        /**
+         * @brief Lets the functions be evaluated concurrently on a thread pool, when an evaluation is expensive enough.
+         * @details The first evaluation after this call is serial, and its duration is taken as the cost of evaluating
+         *          the array. If the cost is at least `threshold`, subsequent evaluations dispatch the functions to the
+         *          pool, and so does the assembly of the Jacobian (see `executor()`); otherwise the array stays serial,
+         *          as the synchronization would cost more than it saves.
+         *          Copies of the array share the setting, so it should be made before the array is passed to a solver.
+         * @param pool The thread pool to use, or nullptr to evaluate serially. The pool must outlive the array.
+         * @param threshold The minimum cost of a serial evaluation for the concurrent evaluation to be used.
+         * @note The functions must be safe to call concurrently.
+         */
+        void setExecutor(ThreadPool* pool, std::chrono::nanoseconds threshold = std::chrono::microseconds(50))
+        {
+            m_executor = pool ? std::make_shared< Executor >(pool, threshold) : nullptr;
+        }
+
+        /**
+         * @brief Returns the thread pool to distribute work over the functions with, if the evaluation has been found
+         *        expensive enough to benefit from it.
+         * @return The thread pool, or nullptr if the functions should be processed serially.
+         */
+        [[nodiscard]]
+        ThreadPool* executor() const
+        {
+            if (!m_executor || functions.size() < 2 || m_executor->pool->size() < 2) return nullptr;
+            const auto cost = m_executor->cost.load(std::memory_order_relaxed);
+            return cost >= m_executor->threshold.count() ? m_executor->pool : nullptr;
+        }
+
         /**
          * @brief Applies all functions to the input container and returns a container of the same type.
          * @tparam CONTAINER_T Type of the input container.
@@ -291,7 +340,45 @@ namespace nxx::multiroots
         auto size() const { return functions.size(); }
 
     private:
-        std::vector< FUNC_T > functions;    ///< Internal storage for function objects.
+        /**
+         * @brief The thread pool used for concurrent evaluation, and the measured cost of a serial evaluation.
+         */
+        struct Executor
+        {
+            Executor(ThreadPool* p, std::chrono::nanoseconds t) : pool(p), threshold(t) {}
+
+            ThreadPool*                 pool;          /**< The thread pool. */
+            std::chrono::nanoseconds    threshold;     /**< The minimum cost for concurrent evaluation. */
+            std::atomic< std::int64_t > cost { -1 };   /**< The cost of a serial evaluation in ns; negative if not yet measured. */
+        };
+
+        std::vector< FUNC_T >       functions;     ///< Internal storage for function objects.
+        std::shared_ptr< Executor > m_executor;    ///< The executor for concurrent evaluation, if any.
+
+        /**
+         * @brief Calls `body(i)` for the index of each function, concurrently if the executor says so.
+         * @details If an executor has been set, but the cost of an evaluation is not yet known, the calls are
+         *          made serially and timed.
+         * @param body The callable to invoke with the index of each function.
+         */
+        template< typename BODY_T >
+        void dispatch(BODY_T&& body) const
+        {
+            if (auto* pool = executor()) {
+                pool->parallel_for(functions.size(), body);
+                return;
+            }
+
+            if (!m_executor || m_executor->cost.load(std::memory_order_relaxed) >= 0) {
+                for (size_t i = 0; i < functions.size(); ++i) body(i);
+                return;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < functions.size(); ++i) body(i);
+            const auto cost = std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start);
+            m_executor->cost.store(cost.count(), std::memory_order_relaxed);
+        }
 
         /**
          * @brief Evaluates the input container using the stored functions and returns an output container of the specified type.
@@ -301,16 +388,22 @@ namespace nxx::multiroots
          * @return OUT_T An output container of the specified type containing the results.
          * @details This method transforms each function's result into an output container of type OUT_T.
          *          It requires that OUT_T is constructible with the size of the input and provides an iterator interface.
+         *          If the input stores elements of type PARAM_T contiguously, it is passed to the functions as a view;
+         *          otherwise, it is converted once, and the converted values are shared by all the functions.
          */
         template< typename OUT_T, typename CONT_T >
         OUT_T evaluate(const CONT_T& input) const
         {
-            OUT_T                result(functions.size());
-            std::vector< RET_T > args(input.begin(), input.end());
+            OUT_T result(functions.size());
 
-            std::transform(functions.begin(), functions.end(), result.begin(), [&args](const auto& func) {
-                return std::invoke(func, args);
-            });
+            if constexpr (requires { std::span< const PARAM_T >(std::data(input), std::size(input)); }) {
+                const std::span< const PARAM_T > args(std::data(input), std::size(input));
+                dispatch([&](size_t i) { result[i] = functions[i](args); });
+            }
+            else {
+                const std::vector< PARAM_T > args(input.begin(), input.end());
+                dispatch([&](size_t i) { result[i] = functions[i](args); });
+            }
 
             return result;
         }
@@ -0,0 +1,287 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file MultiFunctionSystem.hpp
+ * @brief This file contains the declaration of the MultiFunctionSystem class.
+ *
+ * The MultiFunctionSystem class wraps a single callable, which evaluates all the functions of a system
+ * of equations in one call and writes the results into preallocated storage. As opposed to the
+ * MultiFunctionArray class, the type of the callable is preserved, i.e. no type erasure is involved,
+ * and subexpressions shared between the equations need only be computed once per evaluation.
+ * Optionally, the system may also carry a callable computing the (analytic) Jacobian, which is then
+ * used by the multiroot solvers instead of finite differences.
+ */
+
+#ifndef NUMERIXX_MULTIFUNCTIONSYSTEM_HPP
+#define NUMERIXX_MULTIFUNCTIONSYSTEM_HPP
+
+#include "FunctionTraits.hpp"
+
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <Concepts.hpp>
+
+namespace nxx::multiroots
+{
+    /**
+     * @brief Placeholder for the Jacobian of a MultiFunctionSystem without an analytic Jacobian.
+     */
+    struct NoJacobian
+    {};
+
+    /**
+     * @class MultiFunctionSystem
+     * @brief Template class for a system of equations, evaluated by a single callable.
+     *
+     * @details The callable must have the signature `void(std::span<const T> x, std::span<T> f)`, i.e. it
+     *          takes the point of evaluation and writes the function values into `f`. The system is assumed
+     *          to be square, i.e. the number of equations equals the number of unknowns.
+     *
+     *          The Jacobian callable is optional, and may take one of two forms:
+     *          - `void(std::span<const T> x, auto& J)`, writing the Jacobian at `x` into the matrix `J`, or
+     *          - `void(std::span<const T> x, std::span<T> f, auto& J)`, writing both the function values and the
+     *            Jacobian (a fused evaluation, for models where the two share most of the work).
+     *
+     *          `J` is a Blaze matrix of size N x N, which is zeroed before the call, so only the non-zero elements
+     *          need to be written. With a fused Jacobian, the first callable is still used wherever the function
+     *          values alone are required (e.g. at the trial points of a line search).
+     *
+     * @tparam T The value type of the arguments and the function values.
+     * @tparam FN_T The type of the callable.
+     * @tparam JAC_T The type of the Jacobian callable, or NoJacobian.
+     */
+    template< IsFloat T, typename FN_T, typename JAC_T = NoJacobian >
+    requires std::invocable< const FN_T&, std::span< const T >, std::span< T > >
+    class MultiFunctionSystem
+    {
+    public:
+        using return_type   = T;        ///< Alias for the type of the function values.
+        using param_type    = T;        ///< Alias for the type of the arguments.
+        using function_type = FN_T;     ///< Alias for the type of the callable.
+        using jacobian_type = JAC_T;    ///< Alias for the type of the Jacobian callable.
+
+        static constexpr bool has_jacobian = !std::same_as< JAC_T, NoJacobian >;    ///< True if the Jacobian is provided.
+
+        /**
+         * @brief True if the Jacobian callable is fused, i.e. computes the function values as well, for matrices of type MATRIX_T.
+         */
+        template< typename MATRIX_T >
+        static constexpr bool has_fused_jacobian = std::invocable< const JAC_T&, std::span< const T >, std::span< T >, MATRIX_T& >;
+
+        /**
+         * @brief Constructs a MultiFunctionSystem object with a given callable.
+         * @param function The callable evaluating the system.
+         */
+        explicit MultiFunctionSystem(FN_T function)
+            : m_function { std::move(function) }
+        {}
+
+        /**
+         * @brief Constructs a MultiFunctionSystem object with a given callable and a callable computing the Jacobian.
+         * @param function The callable evaluating the system.
+         * @param jacobian The callable computing the Jacobian, or both the function values and the Jacobian.
+         */
+        MultiFunctionSystem(FN_T function, JAC_T jacobian)
+            : m_function { std::move(function) },
+              m_jacobian { std::move(jacobian) }
+        {}
+
+        /**
+         * @brief Evaluates the system, writing the function values into preallocated storage.
+         * @param input The point of evaluation.
+         * @param output The storage for the function values; must have the same size as `input`.
+         */
+        void operator()(std::span< const T > input, std::span< T > output) const { m_function(input, output); }
+
+        /**
+         * @brief Evaluates the system and returns a container of the same type as the input.
+         * @tparam CONTAINER_T Type of the input container.
+         * @param input The input container.
+         * @return CONTAINER_T A container of the same type as input, containing the function values.
+         */
+        template< typename CONTAINER_T >
+        CONTAINER_T operator()(const CONTAINER_T& input) const
+        {
+            return evaluate< CONTAINER_T >(input);
+        }
+
+        /**
+         * @brief Evaluates the system at the point given by an initializer list.
+         * @param input An initializer list of input values.
+         * @return std::vector<T> A vector containing the function values.
+         */
+        std::vector< T > operator()(std::initializer_list< T > input) const { return evaluate< std::vector< T > >(input); }
+
+        /**
+         * @brief Evaluates the system and returns a container of the same type as the input.
+         * @tparam CONTAINER_T Type of the input container.
+         * @param input The input container.
+         * @return CONTAINER_T A container of the same type as input, containing the function values.
+         */
+        template< typename CONTAINER_T >
+        CONTAINER_T eval(const CONTAINER_T& input) const
+        {
+            return evaluate< CONTAINER_T >(input);
+        }
+
+        /**
+         * @brief Evaluates the system and returns a container of the specified output type.
+         * @tparam OUT_T Template template parameter specifying the type of the output container.
+         * @tparam CONTAINER_T Type of the input container.
+         * @param input The input container.
+         * @return OUT_T<T> An output container of the specified type containing the function values.
+         */
+        template< template< typename... > class OUT_T, typename CONTAINER_T >
+        OUT_T< T > eval(const CONTAINER_T& input) const
+        {
+            return evaluate< OUT_T< T > >(input);
+        }
+
+        /**
+         * @brief Evaluates the system and returns an output container with additional template parameters.
+         * @tparam OUT_T Template template parameter specifying the type of the output container, with additional template parameters.
+         * @tparam CONTAINER_T Type of the input container.
+         * @param input The input container.
+         * @return OUT_T<T, false> An output container of the specified type containing the function values.
+         */
+        template< template< typename, bool, typename... > class OUT_T, typename CONTAINER_T >
+        OUT_T< T, false > eval(const CONTAINER_T& input) const
+        {
+            return evaluate< OUT_T< T, false > >(input);
+        }
+
+        /**
+         * @brief Evaluates the function values and the Jacobian at the given point.
+         * @details If the Jacobian callable is fused, both are computed by a single call; otherwise, the two
+         *          callables are invoked one after the other.
+         * @param input The point of evaluation.
+         * @param output The storage for the function values; must have the same size as `input`.
+         * @param J The matrix receiving the Jacobian; must be of size N x N.
+         */
+        template< typename MATRIX_T >
+        requires has_jacobian
+        void operator()(std::span< const T > input, std::span< T > output, MATRIX_T& J) const
+        {
+            J.reset();
+            if constexpr (has_fused_jacobian< MATRIX_T >)
+                m_jacobian(input, output, J);
+            else {
+                m_function(input, output);
+                m_jacobian(input, J);
+            }
+        }
+
+        /**
+         * @brief Computes the Jacobian at the given point.
+         * @details With a fused Jacobian callable, the function values are written into `scratch`, and discarded.
+         *          Only if no scratch storage of sufficient size is given, a temporary vector is allocated.
+         * @param input The point of evaluation.
+         * @param J The matrix receiving the Jacobian; must be of size N x N.
+         * @param scratch Optional storage for the function values computed by a fused Jacobian callable.
+         */
+        template< typename MATRIX_T >
+        requires has_jacobian
+        void jacobian(std::span< const T > input, MATRIX_T& J, std::span< T > scratch = {}) const
+        {
+            J.reset();
+            if constexpr (has_fused_jacobian< MATRIX_T >) {
+                if (scratch.size() >= input.size())
+                    m_jacobian(input, scratch.first(input.size()), J);
+                else {
+                    std::vector< T > output(input.size());
+                    m_jacobian(input, std::span< T >(output), J);
+                }
+            }
+            else
+                m_jacobian(input, J);
+        }
+
+        /**
+         * @brief Provides access to the wrapped callable.
+         * @return const FN_T& A reference to the callable.
+         */
+        const FN_T& function() const { return m_function; }
+
+    private:
+        FN_T                        m_function;      ///< The callable evaluating the system.
+        [[no_unique_address]] JAC_T m_jacobian {};    ///< The callable computing the Jacobian, if any.
+
+        /**
+         * @brief Evaluates the system and returns an output container of the specified type.
+         * @tparam OUT_T Type of the output container.
+         * @tparam CONT_T Type of the input container, which must store its elements contiguously.
+         * @param input The input container.
+         * @return OUT_T An output container of the specified type containing the function values.
+         */
+        template< typename OUT_T, typename CONT_T >
+        OUT_T evaluate(const CONT_T& input) const
+        {
+            OUT_T result(std::size(input));
+            m_function(std::span< const T >(std::data(input), std::size(input)), std::span< T >(std::data(result), std::size(result)));
+            return result;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for MultiFunctionSystem, deducing the value type from the output parameter of the callable.
+     */
+    template< typename FN_T >
+    MultiFunctionSystem(FN_T) -> MultiFunctionSystem< typename traits::FunctionTraits< std::decay_t< FN_T > >::output_type::value_type,
+                                                      std::decay_t< FN_T > >;
+
+    /**
+     * @brief Deduction guide for MultiFunctionSystem with a Jacobian callable.
+     */
+    template< typename FN_T, typename JAC_T >
+    MultiFunctionSystem(FN_T, JAC_T) -> MultiFunctionSystem< typename traits::FunctionTraits< std::decay_t< FN_T > >::output_type::value_type,
+                                                             std::decay_t< FN_T >,
+                                                             std::decay_t< JAC_T > >;
+
+    /**
+     * @brief Concept for systems of equations that provide an analytic Jacobian.
+     */
+    template< typename FUNCTION_T >
+    concept HasJacobian = requires { requires FUNCTION_T::has_jacobian; };
+
+    /**
+     * @brief Concept for systems of equations that compute the function values and the Jacobian in a single call.
+     */
+    template< typename FUNCTION_T, typename MATRIX_T >
+    concept HasFusedJacobian = HasJacobian< FUNCTION_T > && requires { requires FUNCTION_T::template has_fused_jacobian< MATRIX_T >; };
+
+}    // namespace nxx::multiroots
+
+#endif    // NUMERIXX_MULTIFUNCTIONSYSTEM_HPP
@@ -32,26 +32,66 @@
 #define NUMERIXX_MULTIROOTS_IMPL_HPP
 
 // ===== Numerixx Includes
+#include "LineSearch.hpp"
 #include "MultiDerivatives.hpp"
+#include "StaticMultiFunction.hpp"
 #include <Constants.hpp>
 #include <Deriv.hpp>
-#include <Poly.hpp>
+#include <Error.hpp>
 
 // ===== External Includes
 #include <blaze/Blaze.h>
 
 // ===== Standard Library Includes
-#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <span>
 #include <stdexcept>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 
 namespace nxx::multiroots
 {
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
+    /**
+     * @brief Concept for the function types accepted by the multiroot solvers, i.e. MultiFunctionArray and
+     *        MultiFunctionSystem. Both evaluate all the functions of the system at a given point.
+     */
+    template< typename FUNCTION_T >
+    concept IsMultiFunction = IsFloat< typename FUNCTION_T::return_type > && IsFloat< typename FUNCTION_T::param_type >;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
     class MultiNewton;
 
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class ChordNewton;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
     class SteepestDescent;
 
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class Broyden;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class BroydenBad;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class Dogleg;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class LevenbergMarquardt;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class NewtonKrylov;
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class Anderson;
+
     /*
      * Forward declaration of the PolishingTraits class.
      */
@@ -61,19 +101,75 @@ namespace nxx::multiroots
     /*
      * Specialization of the PolishingTraits class for Newton<FN, DFN>
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
-    struct MultirootsSolverTraits< MultiNewton< RES_T, PARAM_T, ARG_T > >
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< MultiNewton< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< ChordNewton< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< SteepestDescent< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< Broyden< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< BroydenBad< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< Dogleg< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< LevenbergMarquardt< FUNCTION_T, ARG_T > >
+    {
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
+        using arg_type    = ARG_T;
+    };
+
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< NewtonKrylov< FUNCTION_T, ARG_T > >
     {
-        using return_type = RES_T;
-        using param_type  = PARAM_T;
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
         using arg_type    = ARG_T;
     };
 
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
-    struct MultirootsSolverTraits< SteepestDescent< RES_T, PARAM_T, ARG_T > >
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    struct MultirootsSolverTraits< Anderson< FUNCTION_T, ARG_T > >
     {
-        using return_type = RES_T;
-        using param_type  = PARAM_T;
+        using return_type = typename FUNCTION_T::return_type;
+        using param_type  = typename FUNCTION_T::param_type;
         using arg_type    = ARG_T;
     };
 
@@ -92,16 +188,38 @@ namespace nxx::multiroots
 
     namespace detail
     {
+        /**
+         * @brief The number of unknowns of a system of equations, if known at compile time, and zero otherwise.
+         * @tparam FUNCTION_T The type of the functions.
+         */
+        template< typename FUNCTION_T >
+        inline constexpr size_t StaticExtent = 0;
+
+        /**
+         * @brief Specialization of StaticExtent for systems of equations wrapped in a StaticMultiFunction.
+         */
+        template< typename FUNCTION_T, size_t N >
+        inline constexpr size_t StaticExtent< StaticMultiFunction< FUNCTION_T, N > > = N;
+
+        /**
+         * @brief Concept for solvers that keep all of their state in fixed-size storage when solving a
+         *        StaticMultiFunction. Only such solvers can be used with `multisolve<SOLVER, N>`.
+         */
+        template< typename SOLVER_T >
+        concept IsFixedSizeSolver = requires { requires SOLVER_T::SupportsFixedSize; };
+
         /**
          * @class MultirootBase
          * @brief Template class for base multi-root solver.
          *
+         * @details If the size of the system is known at compile time, i.e. if FUNCTION_T is a StaticMultiFunction,
+         *          the root estimate and the function values are stored in fixed-size vectors on the stack.
+         *
          * @tparam DERIVED The derived class that inherits from MultirootBase.
-         * @tparam RES_T The return type of the functions used in the solver.
-         * @tparam PARAM_T The parameter type of the functions used in the solver.
+         * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
          * @tparam ARG_T The type of the arguments used for initial guess.
          */
-        template< typename DERIVED, IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
+        template< typename DERIVED, IsMultiFunction FUNCTION_T, IsFloat ARG_T >
         class MultirootBase
         {
             friend DERIVED;
@@ -109,11 +227,18 @@ namespace nxx::multiroots
         public:
             static constexpr bool IsMultirootSolver = true;    ///< Flag indicating this is a multi-root solver.
 
-            using return_type = RES_T;                                   ///< Alias for return type.
-            using param_type  = PARAM_T;                                 ///< Alias for parameter type.
-            using arg_type    = ARG_T;                                   ///< Alias for argument type.
-            using RETURN_T    = blaze::DynamicVector< RES_T >;           ///< Alias for Blaze dynamic vector.
-            using FUNCTION_T  = MultiFunctionArray< RES_T, PARAM_T >;    ///< Alias for function array type.
+            using return_type   = typename FUNCTION_T::return_type;    ///< Alias for return type.
+            using param_type    = typename FUNCTION_T::param_type;     ///< Alias for parameter type.
+            using arg_type      = ARG_T;                               ///< Alias for argument type.
+            using function_type = FUNCTION_T;                          ///< Alias for the type of the functions.
+            using RES_T         = return_type;                         ///< Alias for return type.
+
+            static constexpr size_t extent = StaticExtent< FUNCTION_T >;    ///< Number of unknowns, or zero if not fixed.
+
+            /**
+             * @brief Alias for the vector type; a Blaze static vector if the size is fixed, otherwise a Blaze dynamic vector.
+             */
+            using RETURN_T = std::conditional_t< extent == 0, blaze::DynamicVector< RES_T >, blaze::StaticVector< RES_T, extent > >;
 
         protected:
             /**
@@ -122,34 +247,56 @@ namespace nxx::multiroots
             ~MultirootBase() = default;
 
         private:
+            /**
+             * @brief Creates a vector with the given number of elements.
+             * @param size The number of elements.
+             * @return A RETURN_T object of the given size.
+             * @throws NumerixxError If the size of the system is fixed, and differs from the given size.
+             */
+            static RETURN_T makeVector(size_t size)
+            {
+                if constexpr (extent == 0)
+                    return RETURN_T(size);
+                else {
+                    static_assert(IsFixedSizeSolver< DERIVED >, "The solver does not support systems of fixed size.");
+                    if (size != extent)
+                        throw NumerixxError("The size of the initial guess does not match the size of the system.",
+                                            NumerixxErrorType::MultiRoots);
+                    return RETURN_T {};
+                }
+            }
+
             FUNCTION_T m_functions {};    ///< Storage for function objects.
-            RETURN_T   m_guess {};        ///< Initial guess for the roots.
+            RETURN_T   m_guess {};        ///< Current estimate of the roots.
+            RETURN_T   m_fval {};         ///< Function values at the current estimate, updated along with it.
 
         public:
             /**
              * @brief Constructor initializing the multi-root solver with functions and an initial guess.
              * @tparam ARR Container type for the initial guess.
-             * @param functions A MultiFunctionArray object containing the functions for root solving.
+             * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
              * @param guess Initial guess for the roots.
              */
             template< typename ARR >    // Use IsContainer instead??
-            explicit MultirootBase(const MultiFunctionArray< RES_T, PARAM_T >& functions, const ARR& guess)
+            explicit MultirootBase(const FUNCTION_T& functions, const ARR& guess)
                 : m_functions { functions },
-                  m_guess { RETURN_T(guess.size()) }
+                  m_guess { makeVector(guess.size()) }
             {
                 std::copy(guess.begin(), guess.end(), m_guess.begin());
+                m_fval = evaluate(m_guess);
             }
 
             /**
              * @brief Constructor initializing the multi-root solver with functions and an initializer list as the guess.
-             * @param functions A MultiFunctionArray object containing the functions for root solving.
+             * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
              * @param guess Initial guess for the roots provided as an initializer list.
              */
-            explicit MultirootBase(const MultiFunctionArray< RES_T, PARAM_T >& functions, std::initializer_list< ARG_T > guess)
+            explicit MultirootBase(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess)
                 : m_functions { functions },
-                  m_guess { RETURN_T(guess.size()) }
+                  m_guess { makeVector(guess.size()) }
             {
                 std::copy(guess.begin(), guess.end(), m_guess.begin());
+                m_fval = evaluate(m_guess);
             }
 
             // Rule of five: Default copy/move constructors and assignment operators
@@ -163,12 +310,53 @@ namespace nxx::multiroots
              * @brief Evaluates the functions at given values.
              * @tparam ARR Container type for the input values.
              * @param values Container of values for function evaluation.
-             * @return A Blaze dynamic vector containing the results of function evaluations.
+             * @return A RETURN_T vector containing the results of function evaluations.
              */
             template< typename ARR >    // Use IsContainer instead??
             auto evaluate(ARR values)
             {
-                return m_functions.template eval< blaze::DynamicVector >(values);
+                if constexpr (extent == 0)
+                    return m_functions.template eval< blaze::DynamicVector >(values);
+                else {
+                    RETURN_T result {};
+                    m_functions(std::span< const RES_T >(values.data(), values.size()), std::span< RES_T >(result.data(), extent));
+                    return result;
+                }
+            }
+
+            /**
+             * @brief Evaluates the functions at given values, writing the results into existing storage.
+             * @details The function values are written directly into `result`, without allocating a temporary
+             *          vector, provided that the functions can be evaluated into preallocated storage.
+             * @param values The values for function evaluation.
+             * @param result The vector receiving the function values; resized if required.
+             */
+            void evaluate(const RETURN_T& values, RETURN_T& result)
+            {
+                if constexpr (std::is_invocable_v< const FUNCTION_T&, std::span< const RES_T >, std::span< RES_T > >) {
+                    if constexpr (extent == 0) result.resize(values.size());
+                    m_functions(std::span< const RES_T >(values.data(), values.size()), std::span< RES_T >(result.data(), result.size()));
+                }
+                else
+                    result = m_functions.template eval< blaze::DynamicVector >(values);
+            }
+
+            /**
+             * @brief Evaluates the functions and the analytic Jacobian at given values, in a single call if the
+             *        Jacobian callable of the system is fused.
+             * @param values The values for function evaluation.
+             * @param result The vector receiving the function values; resized if required.
+             * @param J The matrix receiving the Jacobian; resized if required.
+             */
+            template< typename MATRIX_T >
+            requires HasJacobian< FUNCTION_T >
+            void evaluate(const RETURN_T& values, RETURN_T& result, MATRIX_T& J)
+            {
+                if constexpr (extent == 0) {
+                    result.resize(values.size());
+                    J.resize(values.size(), values.size(), false);
+                }
+                m_functions(std::span< const RES_T >(values.data(), values.size()), std::span< RES_T >(result.data(), result.size()), J);
             }
 
             /**
@@ -184,9 +372,17 @@ namespace nxx::multiroots
 
             /**
              * @brief Retrieves the current guess.
-             * @return A Blaze dynamic vector representing the current guess.
+             * @return A reference to the Blaze dynamic vector representing the current guess.
              */
-            auto current() const { return m_guess; }
+            const RETURN_T& current() const { return m_guess; }
+
+            /**
+             * @brief Retrieves the function values at the current guess.
+             * @details The function values are computed once per iterate, by the solver, and are shared between the
+             *          convergence check and the computation of the next step.
+             * @return A reference to the Blaze dynamic vector containing the function values.
+             */
+            const RETURN_T& residual() const { return m_fval; }
 
             /**
              * @brief Retrieves the current guess in a specified container type.
@@ -204,6 +400,196 @@ namespace nxx::multiroots
              */
             void iterate() { std::invoke(static_cast< DERIVED& >(*this)); }
         };
+
+        /**
+         * @brief Solves the upper triangular system R * x = b by back substitution.
+         * @param R The upper triangular matrix.
+         * @param b The right-hand side.
+         * @return The solution x.
+         */
+        template< typename MATRIX_T, typename VECTOR_T >
+        VECTOR_T solveUpperTriangular(const MATRIX_T& R, VECTOR_T b)
+        {
+            for (size_t i = b.size(); i-- > 0;) {
+                for (size_t j = i + 1; j < b.size(); ++j) b[i] -= R(i, j) * b[j];
+                b[i] /= R(i, i);
+            }
+            return b;
+        }
+
+        /**
+         * @brief Solves the system L * L^T * x = b, given the Cholesky factor L, by forward and back substitution.
+         * @param L The lower triangular Cholesky factor.
+         * @param b The right-hand side.
+         * @return The solution x.
+         */
+        template< typename MATRIX_T, typename VECTOR_T >
+        VECTOR_T solveCholesky(const MATRIX_T& L, VECTOR_T b)
+        {
+            for (size_t i = 0; i < b.size(); ++i) {
+                for (size_t j = 0; j < i; ++j) b[i] -= L(i, j) * b[j];
+                b[i] /= L(i, i);
+            }
+            for (size_t i = b.size(); i-- > 0;) {
+                for (size_t j = i + 1; j < b.size(); ++j) b[i] -= L(j, i) * b[j];
+                b[i] /= L(i, i);
+            }
+            return b;
+        }
+
+        /**
+         * @brief Solves the linear system A * x = b.
+         * @param A The coefficient matrix.
+         * @param b The right-hand side.
+         * @return The solution x.
+         */
+        template< typename MATRIX_T, typename VECTOR_T >
+        auto solveLinear(const MATRIX_T& A, const VECTOR_T& b)
+        {
+            return blaze::solve(A, b);
+        }
+
+        /**
+         * @brief Solves the linear system A * x = b, for a matrix with a size known at compile time.
+         * @details For N <= 3, the solution is computed by Cramer's rule. For larger systems, Gaussian elimination
+         *          with partial pivoting is used. All loops have compile time bounds, so that they can be unrolled,
+         *          and no memory is allocated. A singular matrix results in a non-finite solution.
+         * @param A The coefficient matrix.
+         * @param b The right-hand side.
+         * @return The solution x.
+         */
+        template< typename T, size_t N, bool SO >
+        blaze::StaticVector< T, N > solveLinear(const blaze::StaticMatrix< T, N, N, SO >& A, blaze::StaticVector< T, N > b)
+        {
+            if constexpr (N == 1) {
+                b[0] /= A(0, 0);
+                return b;
+            }
+            else if constexpr (N == 2) {
+                const T det = A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+                return blaze::StaticVector< T, N > { (b[0] * A(1, 1) - A(0, 1) * b[1]) / det, (A(0, 0) * b[1] - A(1, 0) * b[0]) / det };
+            }
+            else if constexpr (N == 3) {
+                // Cofactors of A; the inverse of A is the transpose of the cofactor matrix, divided by the determinant.
+                const T c00 = A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1);
+                const T c01 = A(1, 2) * A(2, 0) - A(1, 0) * A(2, 2);
+                const T c02 = A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0);
+                const T c10 = A(0, 2) * A(2, 1) - A(0, 1) * A(2, 2);
+                const T c11 = A(0, 0) * A(2, 2) - A(0, 2) * A(2, 0);
+                const T c12 = A(0, 1) * A(2, 0) - A(0, 0) * A(2, 1);
+                const T c20 = A(0, 1) * A(1, 2) - A(0, 2) * A(1, 1);
+                const T c21 = A(0, 2) * A(1, 0) - A(0, 0) * A(1, 2);
+                const T c22 = A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+                const T det = A(0, 0) * c00 + A(0, 1) * c01 + A(0, 2) * c02;
+
+                return blaze::StaticVector< T, N > { (c00 * b[0] + c10 * b[1] + c20 * b[2]) / det,
+                                                     (c01 * b[0] + c11 * b[1] + c21 * b[2]) / det,
+                                                     (c02 * b[0] + c12 * b[1] + c22 * b[2]) / det };
+            }
+            else {
+                using std::abs;
+                auto LU = A;
+
+                // Forward elimination, applying the row operations to b as well.
+                for (size_t k = 0; k < N; ++k) {
+                    size_t pivot = k;
+                    for (size_t i = k + 1; i < N; ++i)
+                        if (abs(LU(i, k)) > abs(LU(pivot, k))) pivot = i;
+                    if (pivot != k) {
+                        for (size_t j = k; j < N; ++j) std::swap(LU(k, j), LU(pivot, j));
+                        std::swap(b[k], b[pivot]);
+                    }
+                    for (size_t i = k + 1; i < N; ++i) {
+                        const T factor = LU(i, k) / LU(k, k);
+                        for (size_t j = k + 1; j < N; ++j) LU(i, j) -= factor * LU(k, j);
+                        b[i] -= factor * b[k];
+                    }
+                }
+
+                // Back substitution.
+                for (size_t i = N; i-- > 0;) {
+                    for (size_t j = i + 1; j < N; ++j) b[i] -= LU(i, j) * b[j];
+                    b[i] /= LU(i, i);
+                }
+                return b;
+            }
+        }
+
+        /**
+         * @brief Solves the linear system A * x = b by LU factorization in lower precision and iterative refinement.
+         * @details A is factorized in float (or in double, for long double systems), which halves the memory traffic
+         *          and doubles the SIMD width of the O(N^3) factorization. The solution is then refined using residuals
+         *          computed in the full precision, until ||b - A*x|| <= ||x|| * ||A|| * eps * sqrt(N), as in LAPACK's
+         *          dsgesv. If the factorization fails, or the refinement does not converge within `maxRefinements`
+         *          steps (typically, if the condition number of A exceeds 1/eps of the lower precision), the system is
+         *          solved by a factorization in the full precision instead.
+         * @param A The coefficient matrix.
+         * @param b The right-hand side.
+         * @param maxRefinements The maximum number of refinement steps.
+         * @return The solution x.
+         */
+        template< typename MATRIX_T, typename VECTOR_T >
+        VECTOR_T solveMixedPrecision(const MATRIX_T& A, const VECTOR_T& b, size_t maxRefinements)
+        {
+            using T     = std::decay_t< decltype(b[0]) >;
+            using LOW_T = std::conditional_t< (sizeof(T) > sizeof(double)), double, float >;
+
+            if constexpr (sizeof(T) <= sizeof(LOW_T))
+                return solveLinear(A, b);
+            else {
+                using std::abs;
+                using std::isfinite;
+
+                const size_t n       = b.size();
+                auto         maxNorm = [n](const auto& v) {
+                    T result {};
+                    for (size_t i = 0; i < n; ++i) result = std::max(result, static_cast< T >(abs(v[i])));
+                    return result;
+                };
+
+                blaze::DynamicMatrix< LOW_T, blaze::columnMajor > lu(A);
+                std::vector< blaze::blas_int_t >                  pivots(n);
+                bool                                              factorized = true;
+                try {
+                    blaze::getrf(lu, pivots.data());
+                    for (size_t i = 0; i < n && factorized; ++i) factorized = abs(lu(i, i)) > 0 && isfinite(lu(i, i));
+                }
+                catch (const std::exception&) {
+                    factorized = false;
+                }
+
+                if (factorized) {
+                    T normA {};
+                    for (size_t i = 0; i < A.rows(); ++i) {
+                        T rowSum {};
+                        for (size_t j = 0; j < A.columns(); ++j) rowSum += abs(A(i, j));
+                        normA = std::max(normA, rowSum);
+                    }
+                    const T tolerance = normA * std::numeric_limits< T >::epsilon() * std::sqrt(static_cast< T >(n));
+
+                    VECTOR_T                      x(n, T {});
+                    VECTOR_T                      r(b);
+                    blaze::DynamicVector< LOW_T > d(n);
+                    for (size_t iter = 0; iter <= maxRefinements; ++iter) {
+                        // The residual is scaled before the conversion, so that small residuals do not underflow.
+                        const T scale = maxNorm(r);
+                        if (!(scale > 0)) return x;
+                        for (size_t i = 0; i < n; ++i) d[i] = static_cast< LOW_T >(r[i] / scale);
+                        blaze::getrs(lu, d, 'N', pivots.data());
+                        for (size_t i = 0; i < n; ++i) x[i] += scale * static_cast< T >(d[i]);
+
+                        for (size_t i = 0; i < n; ++i) {
+                            T sum = b[i];
+                            for (size_t j = 0; j < n; ++j) sum -= A(i, j) * x[j];
+                            r[i] = sum;
+                        }
+                        if (maxNorm(r) <= maxNorm(x) * tolerance) return x;
+                    }
+                }
+
+                return solveLinear(A, b);
+            }
+        }
     }    // namespace detail
 
     // =================================================================================================================
@@ -219,83 +605,301 @@ namespace nxx::multiroots
     //
     // =================================================================================================================
 
+    /**
+     * @brief Selects the mixed-precision solution of the linear systems in MultiNewton.
+     * @details The Jacobian is factorized in lower precision, and the Newton step is recovered to full precision by
+     *          iterative refinement (see detail::solveMixedPrecision), falling back to a full precision factorization
+     *          if the refinement does not converge. This roughly halves the cost of the linear algebra for large
+     *          systems. It has no effect for systems with a size known at compile time.
+     */
+    struct MixedPrecision
+    {
+        size_t maxRefinements { 10 }; /**< The maximum number of refinement steps before falling back. */
+    };
+
     /**
      * @class MultiNewton
      * @brief Template class implementing the Newton-Raphson method for multi-root solving.
      *
-     * @tparam RES_T The return type of the functions used in the solver.
-     * @tparam PARAM_T The parameter type of the functions used in the solver.
+     * @details By default, the full Newton step is taken in each iteration. If a line search is provided, the
+     *          step is damped, such that the merit function 0.5 * ||F(x)||^2 is sufficiently reduced. This extends
+     *          the region of convergence, at the cost of additional function evaluations when steps are rejected.
+     *          If MixedPrecision is given, the linear systems are solved by a lower precision factorization and
+     *          iterative refinement.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
      * @tparam ARG_T The type of the arguments used for initial guess.
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
-    class MultiNewton final : public detail::MultirootBase< MultiNewton< RES_T, PARAM_T, ARG_T >, RES_T, PARAM_T, ARG_T >
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class MultiNewton final : public detail::MultirootBase< MultiNewton< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
     {
-        using BASE = detail::MultirootBase< MultiNewton< RES_T, PARAM_T, ARG_T >, RES_T, PARAM_T, ARG_T >;
+        using BASE     = detail::MultirootBase< MultiNewton< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = typename BASE::RETURN_T;
+        using MATRIX_T = std::conditional_t< BASE::extent == 0,
+                                             blaze::DynamicMatrix< RES_T >,
+                                             blaze::StaticMatrix< RES_T, BASE::extent, BASE::extent > >;
 
     public:
+        static constexpr bool SupportsFixedSize = true;    ///< All temporaries are fixed-size for a StaticMultiFunction.
+
         /**
          * @brief Inherits constructors from the base class MultirootBase.
          */
         using BASE::BASE;
 
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a line search (damped Newton).
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param linesearch The line search, i.e. ArmijoBacktracking or MoreThuente.
+         */
+        template< typename ARR >
+        MultiNewton(const FUNCTION_T& functions, const ARR& guess, LineSearch< RES_T > linesearch)
+            : BASE(functions, guess),
+              m_linesearch { std::move(linesearch) }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a line search (damped Newton).
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param linesearch The line search, i.e. ArmijoBacktracking or MoreThuente.
+         */
+        MultiNewton(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess, LineSearch< RES_T > linesearch)
+            : BASE(functions, guess),
+              m_linesearch { std::move(linesearch) }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and mixed-precision linear solves.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param mixed The settings for the mixed-precision solves.
+         */
+        template< typename ARR >
+        MultiNewton(const FUNCTION_T& functions, const ARR& guess, MixedPrecision mixed)
+            : BASE(functions, guess),
+              m_mixed { mixed }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and mixed-precision linear solves.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param mixed The settings for the mixed-precision solves.
+         */
+        MultiNewton(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess, MixedPrecision mixed)
+            : BASE(functions, guess),
+              m_mixed { mixed }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess, a line search and mixed-precision
+         *        linear solves.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param linesearch The line search, i.e. ArmijoBacktracking or MoreThuente.
+         * @param mixed The settings for the mixed-precision solves.
+         */
+        template< typename ARR >
+        MultiNewton(const FUNCTION_T& functions, const ARR& guess, LineSearch< RES_T > linesearch, MixedPrecision mixed)
+            : BASE(functions, guess),
+              m_linesearch { std::move(linesearch) },
+              m_mixed { mixed }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess, a line search and mixed-precision
+         *        linear solves.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param linesearch The line search, i.e. ArmijoBacktracking or MoreThuente.
+         * @param mixed The settings for the mixed-precision solves.
+         */
+        MultiNewton(const FUNCTION_T& functions,
+                    std::initializer_list< ARG_T > guess,
+                    LineSearch< RES_T >            linesearch,
+                    MixedPrecision                 mixed)
+            : BASE(functions, guess),
+              m_linesearch { std::move(linesearch) },
+              m_mixed { mixed }
+        {}
+
         /**
          * @brief Overloaded function call operator implementing the Newton-Raphson iteration step.
          * @details This method updates the current guess by solving the linear system J * dx = -f(x) and updating the root estimate.
          */
         void operator()()
         {
-            using namespace blaze;
             using namespace nxx::deriv;
 
             // Solve the linear system J * dx = -f(x) (solving for dx) and update the root estimate (x_new = x_old + dx).
-            BASE::m_guess += solve(jacobian(BASE::m_functions, BASE::m_guess), -BASE::evaluate(BASE::m_guess));
+            // For systems with a size known at compile time, the Jacobian is a fixed-size matrix, and the solve is unrolled.
+            // If the system computes its Jacobian along with the function values, both are computed at the new estimate.
+            if (!m_linesearch) {
+                BASE::m_guess -= solveNewton();
+                if constexpr (HasFusedJacobian< FUNCTION_T, MATRIX_T >) {
+                    BASE::evaluate(BASE::m_guess, BASE::m_fval, m_jacobian);
+                    m_jacobianIsCurrent = true;
+                }
+                else
+                    BASE::evaluate(BASE::m_guess, BASE::m_fval);
+                return;
+            }
+
+            m_direction = solveNewton();
+            for (auto& elem : m_direction) elem = -elem;
+
+            // For the Newton direction, the derivative of the merit function is -||f(x)||^2, without further evaluations.
+            RES_T phi0 {};
+            for (const auto& f : BASE::m_fval) phi0 += f * f;
+            m_merit.reset(BASE::m_functions, BASE::m_guess, m_direction);
+            std::visit([&](const auto& search) { search(m_merit, phi0 / 2, -phi0, RES_T { 1 }); }, *m_linesearch);
+
+            // The last trial point of the line search is the accepted one; take it over if the merit function decreased.
+            // Otherwise, the iterate is left unchanged, and as the next iteration would repeat the same search, the
+            // failure is reported through searchFailed().
+            m_searchFailed = !(m_merit.value() < phi0 / 2);
+            if (!m_searchFailed) {
+                std::swap(BASE::m_guess, m_merit.trial());
+                std::swap(BASE::m_fval, m_merit.values());
+            }
+        }
+
+        /**
+         * @brief Returns true if the line search of the last iteration did not reduce the merit function.
+         * @details This happens if the Newton direction is not a descent direction (e.g. due to an inaccurate
+         *          Jacobian), or if the residual cannot be reduced further in floating point arithmetic.
+         */
+        bool searchFailed() const { return m_searchFailed; }
+
+    private:
+        std::optional< LineSearch< RES_T > >          m_linesearch {};                /**< The line search; if empty, full steps are taken. */
+        std::optional< MixedPrecision >               m_mixed {};                     /**< The mixed-precision settings; if empty, solves are in RES_T. */
+        detail::MeritFunction< FUNCTION_T, VECTOR_T > m_merit {};                     /**< The merit function, caching the trial points. */
+        VECTOR_T                                      m_direction {};                 /**< The Newton direction. */
+        MATRIX_T                                      m_jacobian {};                  /**< The Jacobian, if computed along with the function values. */
+        bool                                          m_jacobianIsCurrent { false };  /**< True if m_jacobian is the Jacobian at the current guess. */
+        bool                                          m_searchFailed { false };       /**< True if the last line search did not reduce the merit function. */
+
+        /**
+         * @brief Computes the Jacobian at the current guess (unless already available), and solves J * dx = f(x).
+         * @return The solution dx, i.e. the negative of the Newton step.
+         */
+        VECTOR_T solveNewton()
+        {
+            using namespace nxx::deriv;
+
+            if (!m_jacobianIsCurrent) m_jacobian = jacobian(BASE::m_functions, BASE::m_guess);
+            m_jacobianIsCurrent = false;
+
+            if constexpr (BASE::extent == 0)
+                if (m_mixed) return detail::solveMixedPrecision(m_jacobian, BASE::m_fval, m_mixed->maxRefinements);
+            return detail::solveLinear(m_jacobian, BASE::m_fval);
         }
     };
 
     /**
-     * @brief Deduction guide for MultiNewton with a MultiFunctionArray and an arbitrary container type.
-     * @tparam RES_T The return type of the functions.
-     * @tparam PARAM_T The parameter type of the functions.
+     * @brief Deduction guide for MultiNewton with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    MultiNewton(FUNCTION_T, ARR_T) -> MultiNewton< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for MultiNewton with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    MultiNewton(FUNCTION_T, std::initializer_list< ARG_T >) -> MultiNewton< FUNCTION_T, ARG_T >;
+
+    /**
+     * @brief Deduction guide for MultiNewton with a function array or system, an arbitrary container type and a line search
+     *        or mixed-precision settings.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     * @tparam LINESEARCH_T The type of the line search, or MixedPrecision.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T, typename LINESEARCH_T >
+    MultiNewton(FUNCTION_T, ARR_T, LINESEARCH_T) -> MultiNewton< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for MultiNewton with a function array or system, an initializer list and a line search or
+     *        mixed-precision settings.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     * @tparam LINESEARCH_T The type of the line search, or MixedPrecision.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T, typename LINESEARCH_T >
+    MultiNewton(FUNCTION_T, std::initializer_list< ARG_T >, LINESEARCH_T) -> MultiNewton< FUNCTION_T, ARG_T >;
+
+    /**
+     * @brief Deduction guide for MultiNewton with a function array or system, an arbitrary container type, a line search
+     *        and mixed-precision settings.
+     * @tparam FUNCTION_T The type of the functions.
      * @tparam ARR_T The container type for the initial guess.
+     * @tparam LINESEARCH_T The type of the line search.
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, typename ARR_T >
-    MultiNewton(MultiFunctionArray< RES_T, PARAM_T >, ARR_T) -> MultiNewton< RES_T, PARAM_T, traits::ContainerValueType_t< ARR_T > >;
+    template< IsMultiFunction FUNCTION_T, typename ARR_T, typename LINESEARCH_T >
+    MultiNewton(FUNCTION_T, ARR_T, LINESEARCH_T, MixedPrecision) -> MultiNewton< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
 
     /**
-     * @brief Deduction guide for MultiNewton with a MultiFunctionArray and an initializer list.
-     * @tparam RES_T The return type of the functions.
-     * @tparam PARAM_T The parameter type of the functions.
+     * @brief Deduction guide for MultiNewton with a function array or system, an initializer list, a line search and
+     *        mixed-precision settings.
+     * @tparam FUNCTION_T The type of the functions.
      * @tparam ARG_T The type of the arguments in the initializer list.
+     * @tparam LINESEARCH_T The type of the line search.
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
-    MultiNewton(MultiFunctionArray< RES_T, PARAM_T >, std::initializer_list< ARG_T >) -> MultiNewton< RES_T, PARAM_T, ARG_T >;
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T, typename LINESEARCH_T >
+    MultiNewton(FUNCTION_T, std::initializer_list< ARG_T >, LINESEARCH_T, MixedPrecision) -> MultiNewton< FUNCTION_T, ARG_T >;
 
     // =================================================================================================================
     //
-    //
-    //  ad88888ba   88888888ba,
-    // d8"     "8b  88      `"8b                                                                ,d
-    // Y8,          88        `8b                                                               88
-    // `Y8aaaaa,    88         88   ,adPPYba,  ,adPPYba,   ,adPPYba,   ,adPPYba,  8b,dPPYba,  MM88MMM
-    //   `"""""8b,  88         88  a8P_____88  I8[    ""  a8"     ""  a8P_____88  88P'   `"8a   88
-    //         `8b  88         8P  8PP"""""""   `"Y8ba,   8b          8PP"""""""  88       88   88
-    // Y8a     a8P  88      .a8P   "8b,   ,aa  aa    ]8I  "8a,   ,aa  "8b,   ,aa  88       88   88,
-    //  "Y88888P"   88888888Y"'     `"Ybbd8"'  `"YbbdP"'   `"Ybbd8"'   `"Ybbd8"'  88       88   "Y888
+    //   ,ad8888ba,   88                                             88
+    //  d8"'    `"8b  88                                             88
+    // d8'            88                                             88
+    // 88             88,dPPYba,    ,adPPYba,   8b,dPPYba,   ,adPPYb,88
+    // 88             88P'    "8a  a8"     "8a  88P'   "Y8  a8"    `Y88
+    // Y8,            88       88  8b       d8  88          8b       88
+    //  Y8a.    .a8P  88       88  "8a,   ,a8"  88          "8a,   ,d88
+    //   `"Y8888Y"'   88       88   `"YbbdP"'   88           `"8bbdP"Y8
     //
     // =================================================================================================================
 
     /**
-     * @class SteepestDescent
-     * @brief Template class implementing the Steepest Descent method for multi-root solving.
+     * @class ChordNewton
+     * @brief Template class implementing the chord (Shamanskii) variant of Newton's method for multi-root solving.
+     *
+     * @details The Jacobian is computed and LU factorized (using getrf), and the factors are reused (using getrs) for
+     *          up to `reuse` iterations. Hence, an iteration using the stored factors requires a single evaluation of
+     *          the functions and O(N^2) operations, as opposed to the O(N^2) function evaluations and O(N^3) operations
+     *          required by MultiNewton. If a step using the stored factors does not reduce ||f|| by at least the
+     *          given contraction factor, the step is discarded, and the Jacobian is refactored at the current guess.
+     *          With `reuse` equal to one, the method reduces to Newton's method.
      *
-     * @tparam RES_T The return type of the functions used in the solver.
-     * @tparam PARAM_T The parameter type of the functions used in the solver.
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
      * @tparam ARG_T The type of the arguments used for initial guess.
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
-    class SteepestDescent final : public detail::MultirootBase< SteepestDescent< RES_T, PARAM_T, ARG_T >, RES_T, PARAM_T, ARG_T >
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class ChordNewton final : public detail::MultirootBase< ChordNewton< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
     {
-        using BASE = detail::MultirootBase< SteepestDescent< RES_T, PARAM_T, ARG_T >, RES_T, PARAM_T, ARG_T >;
+        using BASE     = detail::MultirootBase< ChordNewton< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T, blaze::columnMajor >;
+
+        MATRIX_T                         m_lu {};                /**< The LU factors of the Jacobian. */
+        std::vector< blaze::blas_int_t > m_pivots {};            /**< The pivot indices of the LU factorization. */
+        VECTOR_T                         m_ftrial {};            /**< Storage for the function values at the trial point. */
+        size_t                           m_age {};               /**< The number of steps taken using the current factors. */
+        size_t                           m_reuse { 10 };         /**< The maximum number of steps using the same factors. */
+        RES_T                            m_contraction { 0.5 };  /**< The required reduction of ||f|| for steps using old factors. */
 
     public:
         /**
@@ -304,203 +908,1332 @@ namespace nxx::multiroots
         using BASE::BASE;
 
         /**
-         * @brief Overloaded function call operator implementing the Steepest Descent iteration step.
-         * @details This method updates the current guess by computing the gradient, direction, and step size,
-         *          and then updating the root estimate accordingly.
+         * @brief Constructor initializing the solver with functions, an initial guess and the refactoring criteria.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param reuse The maximum number of steps using the same LU factors.
+         * @param contraction The required reduction of ||f|| for a step using old factors to be accepted.
          */
-        void operator()()
-        {
-            auto gradient  = computeGradient(BASE::m_guess);
-            auto direction = 1.0 / norm(gradient) * gradient;
-            auto stepsize  = computeStepSize(direction);
-            BASE::m_guess  = computeGuess(BASE::m_guess, direction, stepsize);
-        }
+        template< typename ARR >
+        ChordNewton(const FUNCTION_T& functions, const ARR& guess, size_t reuse, RES_T contraction = 0.5)
+            : BASE(functions, guess),
+              m_reuse { std::max(reuse, size_t { 1 }) },
+              m_contraction { contraction }
+        {}
 
-    private:
         /**
-         * @brief Computes the G function for a given point.
-         * @param point The point at which to compute the G function.
-         * @return The computed G function value.
+         * @brief Constructor initializing the solver with functions, an initial guess and the refactoring criteria.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param reuse The maximum number of steps using the same LU factors.
+         * @param contraction The required reduction of ||f|| for a step using old factors to be accepted.
          */
-        auto computeGFunction(const auto& point)
-        {
-            auto  f_eval = BASE::evaluate(point);
-            RES_T result = std::accumulate(f_eval.begin(), f_eval.end(), RES_T {}, [](RES_T sum, const auto& f) { return sum + f * f; });
-            return result;
-        }
+        ChordNewton(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess, size_t reuse, RES_T contraction = 0.5)
+            : BASE(functions, guess),
+              m_reuse { std::max(reuse, size_t { 1 }) },
+              m_contraction { contraction }
+        {}
 
         /**
-         * @brief Computes the gradient vector at a given point.
-         * @param point The point at which to compute the gradient.
-         * @return The gradient vector at the given point.
+         * @brief Overloaded function call operator implementing the chord iteration step.
+         * @details This method solves J * dx = -f(x) using the stored LU factors, refactoring the Jacobian first if the
+         *          factors are missing or have been used `reuse` times, or if the step fails to contract ||f||.
          */
-        blaze::DynamicVector< RES_T > computeGradient(const blaze::DynamicVector< RES_T >& point)
+        void operator()()
         {
             using namespace blaze;
-            using namespace nxx::deriv;
 
-            auto J = jacobian(BASE::m_functions, point);
-            auto F = BASE::evaluate(point);
-            return 2 * trans(J) * F;
+            if (m_lu.rows() == 0 || m_age >= m_reuse) factorize();
+
+            const RES_T fnorm = norm(BASE::m_fval);
+            VECTOR_T    trial = computeTrial();
+
+            if (m_age > 0 && !(norm(m_ftrial) <= m_contraction * fnorm)) {
+                factorize();
+                trial = computeTrial();
+            }
+
+            BASE::m_guess = std::move(trial);
+            std::swap(BASE::m_fval, m_ftrial);
+            ++m_age;
         }
 
+    private:
         /**
-         * @brief Computes the step size for the steepest descent.
-         * @param direction The descent direction.
-         * @return The computed step size.
+         * @brief Computes the Jacobian at the current guess, and its LU factorization.
          */
-        RES_T computeStepSize(const blaze::DynamicVector< RES_T >& direction)
+        void factorize()
         {
             using namespace blaze;
-            using namespace nxx::poly;
-
-            const RES_T a1 = 0;
-            const RES_T a2 = 0.5;
-            const RES_T a3 = 1.0;
-
-            const DynamicVector< RES_T > arg1 = BASE::m_guess;    // - a1 * direction;
-            const DynamicVector< RES_T > arg2 = BASE::m_guess - a2 * direction;
-            const DynamicVector< RES_T > arg3 = BASE::m_guess - direction;    // - a3 * direction;
-
-            const RES_T g1 = computeGFunction(arg1);
-            const RES_T g2 = computeGFunction(arg2);
-            const RES_T g3 = computeGFunction(arg3);
-
-            RES_T stepsize = 0.001;    // A default small step size
-
-            if (g3 < g1) {
-                RES_T               h1 = (g2 - g1) / (a2 - a1);
-                RES_T               h2 = (g3 - g2) / (a3 - a2);
-                RES_T               h3 = (h2 - h1) / (a3 - a1);
-                Polynomial< RES_T > P  = { g1, (h1 - 0.5 * h3), h3 };
-
-                auto P_prime = derivativeOf(P);
-                if (auto roots = poly::polysolve(P_prime); !roots->empty()) {
-                    stepsize = roots->front();    // Take the first root as the optimal step size
-                    if (stepsize < 0 || stepsize > 1) {
-                        stepsize = 0.001;    // If the root is not in the expected range, revert to default
-                    }
-                }
-            }
+            using namespace nxx::deriv;
 
-            return stepsize;
+            m_lu = jacobian(BASE::m_functions, BASE::m_guess);
+            m_pivots.resize(m_lu.rows());
+            getrf(m_lu, m_pivots.data());
+            m_age = 0;
         }
 
         /**
-         * @brief Computes the next guess in the steepest descent method.
-         * @param point The current point.
-         * @param direction The descent direction.
-         * @param stepsize The step size.
-         * @return The next guess point.
+         * @brief Computes the trial point x - J^-1 * f(x) using the stored factors, and the function values at it.
+         * @return The trial point; the function values are stored in m_ftrial.
          */
-        blaze::DynamicVector< RES_T >
-            computeGuess(const blaze::DynamicVector< RES_T >& point, const blaze::DynamicVector< RES_T >& direction, RES_T stepsize)
+        VECTOR_T computeTrial()
         {
             using namespace blaze;
-            DynamicVector< RES_T > new_guess = point - stepsize * direction;
-            auto                   g_new     = computeGFunction(new_guess);
-            auto                   g_current = computeGFunction(point);
 
-            if (g_new >= g_current) {
-                return point;
-                // throw std::runtime_error("Steepest descent failed to improve the solution.");
-            }
+            VECTOR_T step = -BASE::m_fval;
+            getrs(m_lu, step, 'N', m_pivots.data());
 
-            return new_guess;
+            VECTOR_T trial = BASE::m_guess + step;
+            BASE::evaluate(trial, m_ftrial);
+            return trial;
         }
     };
 
     /**
-     * @brief Deduction guide for SteepestDescent with a MultiFunctionArray and an arbitrary container type.
-     * @tparam RES_T The return type of the functions.
-     * @tparam PARAM_T The parameter type of the functions.
+     * @brief Deduction guide for ChordNewton with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    ChordNewton(FUNCTION_T, ARR_T) -> ChordNewton< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for ChordNewton with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    ChordNewton(FUNCTION_T, std::initializer_list< ARG_T >) -> ChordNewton< FUNCTION_T, ARG_T >;
+
+    /**
+     * @brief Deduction guide for ChordNewton with a function array or system, an arbitrary container type and refactoring criteria.
+     * @tparam FUNCTION_T The type of the functions.
      * @tparam ARR_T The container type for the initial guess.
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, typename ARR_T >
-    SteepestDescent(MultiFunctionArray< RES_T, PARAM_T >, ARR_T)
-        -> SteepestDescent< RES_T, PARAM_T, traits::ContainerValueType_t< ARR_T > >;
+    template< IsMultiFunction FUNCTION_T, typename ARR_T, typename... ARGS_T >
+    ChordNewton(FUNCTION_T, ARR_T, size_t, ARGS_T...) -> ChordNewton< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
 
     /**
-     * @brief Deduction guide for SteepestDescent with a MultiFunctionArray and an initializer list.
-     * @tparam RES_T The return type of the functions.
-     * @tparam PARAM_T The parameter type of the functions.
+     * @brief Deduction guide for ChordNewton with a function array or system, an initializer list and refactoring criteria.
+     * @tparam FUNCTION_T The type of the functions.
      * @tparam ARG_T The type of the arguments in the initializer list.
      */
-    template< IsFloat RES_T, IsFloat PARAM_T, IsFloat ARG_T >
-    SteepestDescent(MultiFunctionArray< RES_T, PARAM_T >, std::initializer_list< ARG_T >) -> SteepestDescent< RES_T, PARAM_T, ARG_T >;
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T, typename... ARGS_T >
+    ChordNewton(FUNCTION_T, std::initializer_list< ARG_T >, size_t, ARGS_T...) -> ChordNewton< FUNCTION_T, ARG_T >;
 
     // =================================================================================================================
     //
-    //                                  88           88                          88
-    //                                  88    ,d     ""                          88
-    //                                  88    88                                 88
-    // 88,dPYba,,adPYba,   88       88  88  MM88MMM  88  ,adPPYba,   ,adPPYba,   88  8b       d8   ,adPPYba,
-    // 88P'   "88"    "8a  88       88  88    88     88  I8[    ""  a8"     "8a  88  `8b     d8'  a8P_____88
-    // 88      88      88  88       88  88    88     88   `"Y8ba,   8b       d8  88   `8b   d8'   8PP"""""""
-    // 88      88      88  "8a,   ,a88  88    88,    88  aa    ]8I  "8a,   ,a8"  88    `8b,d8'    "8b,   ,aa
-    // 88      88      88   `"YbbdP'Y8  88    "Y888  88  `"YbbdP"'   `"YbbdP"'   88      "8"       `"Ybbd8"'
     //
+    //  ad88888ba   88888888ba,
+    // d8"     "8b  88      `"8b                                                                ,d
+    // Y8,          88        `8b                                                               88
+    // `Y8aaaaa,    88         88   ,adPPYba,  ,adPPYba,   ,adPPYba,   ,adPPYba,  8b,dPPYba,  MM88MMM
+    //   `"""""8b,  88         88  a8P_____88  I8[    ""  a8"     ""  a8P_____88  88P'   `"8a   88
+    //         `8b  88         8P  8PP"""""""   `"Y8ba,   8b          8PP"""""""  88       88   88
+    // Y8a     a8P  88      .a8P   "8b,   ,aa  aa    ]8I  "8a,   ,aa  "8b,   ,aa  88       88   88,
+    //  "Y88888P"   88888888Y"'     `"Ybbd8"'  `"YbbdP"'   `"Ybbd8"'   `"Ybbd8"'  88       88   "Y888
     //
     // =================================================================================================================
 
-    namespace detail
+    /**
+     * @class SteepestDescent
+     * @brief Template class implementing the Steepest Descent method for multi-root solving.
+     *
+     * @details In each iteration, a line search is performed along the negative gradient of the merit function
+     *          0.5 * ||F(x)||^2. By default, the line search is ArmijoBacktracking, starting from twice the step
+     *          length accepted in the previous iteration.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class SteepestDescent final : public detail::MultirootBase< SteepestDescent< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
     {
+        using BASE     = detail::MultirootBase< SteepestDescent< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = typename BASE::RETURN_T;
 
+    public:
         /**
-         * @brief Solves multi-root problems using a given solver.
-         * @details This function iteratively applies the solver to find the roots of a system of equations,
-         *          and checks for convergence or non-finite results.
-         * @tparam SOLVER The type of the solver, which must conform to the MultirootSolver interface.
-         * @param solver An instance of the solver.
-         * @param eps The convergence tolerance.
-         * @param maxiter The maximum number of iterations allowed.
-         * @return tl::expected<RESULT_T, ERROR_T> A tl::expected object containing the result vector
-         *         or an error if the solution did not converge or if a non-finite result was encountered.
+         * @brief The type of the gradient provider, computing the gradient of the sum of squared residuals at a point.
          */
-        template< typename SOLVER >
-        requires SOLVER::IsMultirootSolver
-        auto multisolve_impl(SOLVER solver, IsFloat auto eps, std::integral auto maxiter)
+        using GRADIENT_T = std::function< blaze::DynamicVector< RES_T >(const blaze::DynamicVector< RES_T >&) >;
+
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a gradient provider.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param gradient A callable computing the gradient of g(x) = sum(f_i(x)^2) at a given point, e.g. using
+         *        `deriv::gradient<ReverseAD>`. It replaces the default, which forms the finite difference Jacobian.
+         */
+        template< typename ARR >
+        SteepestDescent(const FUNCTION_T& functions, const ARR& guess, GRADIENT_T gradient)
+            : BASE(functions, guess),
+              m_gradient { std::move(gradient) }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a gradient provider.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param gradient A callable computing the gradient of g(x) = sum(f_i(x)^2) at a given point.
+         */
+        SteepestDescent(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess, GRADIENT_T gradient)
+            : BASE(functions, guess),
+              m_gradient { std::move(gradient) }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a line search.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param linesearch The line search, i.e. ArmijoBacktracking or MoreThuente.
+         */
+        template< typename ARR >
+        SteepestDescent(const FUNCTION_T& functions, const ARR& guess, LineSearch< RES_T > linesearch)
+            : BASE(functions, guess),
+              m_linesearch { std::move(linesearch) }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a line search.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param linesearch The line search, i.e. ArmijoBacktracking or MoreThuente.
+         */
+        SteepestDescent(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess, LineSearch< RES_T > linesearch)
+            : BASE(functions, guess),
+              m_linesearch { std::move(linesearch) }
+        {}
+
+        /**
+         * @brief Overloaded function call operator implementing the Steepest Descent iteration step.
+         * @details This method computes the gradient, performs a line search along the normalized negative gradient,
+         *          and takes over the accepted trial point and its function values, without evaluating them again.
+         */
+        void operator()()
         {
-            using ERROR_T  = std::runtime_error;
-            using RESULT_T = blaze::DynamicVector< typename SOLVER::return_type >;
-            using RETURN_T = tl::expected< RESULT_T, ERROR_T >;
+            using std::sqrt;
+
+            const auto gradient = computeGradient();
+            RES_T      gnorm {};
+            for (const auto& elem : gradient) gnorm += elem * elem;
+            gnorm = sqrt(gnorm);
+            if (gnorm == RES_T {}) return;
+
+            m_direction = BASE::m_guess;
+            for (size_t i = 0; i < m_direction.size(); ++i) m_direction[i] = -gradient[i] / gnorm;
+
+            // The gradient of the merit function is half the gradient of g(x) = sum(f_i(x)^2).
+            RES_T phi0 {};
+            for (const auto& f : BASE::m_fval) phi0 += f * f;
+            m_merit.reset(BASE::m_functions, BASE::m_guess, m_direction);
+            const RES_T alpha = std::visit([&](const auto& search) { return search(m_merit, phi0 / 2, -gnorm / 2, 2 * m_stepsize); }, m_linesearch);
+
+            if (m_merit.value() < phi0 / 2) {
+                m_stepsize = alpha;
+                std::swap(BASE::m_guess, m_merit.trial());
+                std::swap(BASE::m_fval, m_merit.values());
+            }
+            else
+                m_stepsize = alpha / 4;
+        }
+
+    private:
+        GRADIENT_T                                    m_gradient {};     /**< Optional gradient provider; if empty, the gradient is computed as 2*J^T*F. */
+        LineSearch< RES_T >                           m_linesearch {};   /**< The line search. */
+        detail::MeritFunction< FUNCTION_T, VECTOR_T > m_merit {};        /**< The merit function, caching the trial points. */
+        VECTOR_T                                      m_direction {};    /**< The (normalized) search direction. */
+        RES_T                                         m_stepsize { 0.5 }; /**< Half the initial step length of the next line search. */
+
+        /**
+         * @brief Computes the gradient vector at the current guess.
+         * @return The gradient vector at the current guess.
+         */
+        blaze::DynamicVector< RES_T > computeGradient()
+        {
+            using namespace blaze;
+            using namespace nxx::deriv;
+
+            if (m_gradient) return m_gradient(BASE::m_guess);
+
+            auto J = jacobian(BASE::m_functions, BASE::m_guess);
+            return 2 * trans(J) * BASE::m_fval;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for SteepestDescent with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    SteepestDescent(FUNCTION_T, ARR_T) -> SteepestDescent< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for SteepestDescent with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    SteepestDescent(FUNCTION_T, std::initializer_list< ARG_T >) -> SteepestDescent< FUNCTION_T, ARG_T >;
+
+    /**
+     * @brief Deduction guide for SteepestDescent with a function array or system, an arbitrary container type and a gradient provider.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     * @tparam GRAD_T The type of the gradient provider.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T, typename GRAD_T >
+    SteepestDescent(FUNCTION_T, ARR_T, GRAD_T) -> SteepestDescent< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for SteepestDescent with a function array or system, an initializer list and a gradient provider.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     * @tparam GRAD_T The type of the gradient provider.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T, typename GRAD_T >
+    SteepestDescent(FUNCTION_T, std::initializer_list< ARG_T >, GRAD_T) -> SteepestDescent< FUNCTION_T, ARG_T >;
+
+    // =================================================================================================================
+    //
+    // 88888888ba                                                  88
+    // 88      "8b                                                 88
+    // 88      ,8P                                                 88
+    // 88aaaaaa8P'  8b,dPPYba,   ,adPPYba,   8b       d8   ,adPPYb,88   ,adPPYba,  8b,dPPYba,
+    // 88""""""8b,  88P'   "Y8  a8"     "8a  `8b     d8'  a8"    `Y88  a8P_____88  88P'   `"8a
+    // 88      `8b  88          8b       d8   `8b   d8'   8b       88  8PP"""""""  88       88
+    // 88      a8P  88          "8a,   ,a8"    `8b,d8'    "8a,   ,d88  "8b,   ,aa  88       88
+    // 88888888P"   88           `"YbbdP"'       Y88'      `"8bbdP"Y8   `"Ybbd8"'  88       88
+    //                                           d8'
+    //                                          d8'
+    //
+    // =================================================================================================================
 
-            RETURN_T result = solver.current();
+    /**
+     * @class Broyden
+     * @brief Template class implementing Broyden's ("good") quasi-Newton method for multi-root solving.
+     *
+     * @details The Jacobian is computed only once, for the initial guess, after which it is approximated by
+     *          rank-one (secant) updates, B_{k+1} = B_k + (y - B_k*s)*s^T / (s^T*s), where s is the step and y
+     *          is the change in the function values. Rather than refactoring B in each iteration, the QR
+     *          factorization of B is updated directly, using Givens rotations. Hence, each iteration requires
+     *          a single evaluation of the functions and O(N^2) operations, as opposed to the O(N^2) function
+     *          evaluations and O(N^3) operations required by MultiNewton.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class Broyden final : public detail::MultirootBase< Broyden< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
+    {
+        using BASE     = detail::MultirootBase< Broyden< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T >;
+
+        MATRIX_T m_Q {}; /**< The orthogonal factor of the Jacobian approximation. */
+        MATRIX_T m_R {}; /**< The upper triangular factor of the Jacobian approximation. */
+
+    public:
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Overloaded function call operator implementing the Broyden iteration step.
+         * @details This method solves B * dx = -f(x) using the QR factors, updates the root estimate, and applies the
+         *          rank-one update to the factors. As B * dx = -f(x), the secant residual y - B * dx reduces to f(x_new).
+         */
+        void operator()()
+        {
+            using namespace blaze;
+            using namespace nxx::deriv;
+
+            if (m_R.rows() == 0) qr(jacobian(BASE::m_functions, BASE::m_guess), m_Q, m_R);
+
+            // Solve R * dx = -Q^T * f(x) by back substitution.
+            const VECTOR_T step = detail::solveUpperTriangular(m_R, VECTOR_T(-(trans(m_Q) * BASE::m_fval)));
+
+            BASE::m_guess += step;
+            BASE::evaluate(BASE::m_guess, BASE::m_fval);
+
+            const RES_T sts = dot(step, step);
+            if (sts > 0) updateFactors(BASE::m_fval / sts, step);
+        }
+
+    private:
+        /**
+         * @brief Applies a Givens rotation to rows i and j of R (from column k), and the transpose to columns i and j of Q.
+         */
+        void rotate(size_t i, size_t j, size_t k, RES_T c, RES_T s)
+        {
+            for (size_t col = k; col < m_R.columns(); ++col) {
+                const RES_T a = m_R(i, col);
+                const RES_T b = m_R(j, col);
+                m_R(i, col)   = c * a + s * b;
+                m_R(j, col)   = -s * a + c * b;
+            }
 
-            // Check for NaN or Inf.
-            if (!std::isfinite(norm(solver.evaluate(*result)))) {
-                result = tl::make_unexpected(ERROR_T("Non-finite result!"));
-                return result;
+            for (size_t row = 0; row < m_Q.rows(); ++row) {
+                const RES_T a = m_Q(row, i);
+                const RES_T b = m_Q(row, j);
+                m_Q(row, i)   = c * a + s * b;
+                m_Q(row, j)   = -s * a + c * b;
             }
+        }
+
+        /**
+         * @brief Updates the QR factors of B to the QR factors of B + u * v^T in O(N^2) operations.
+         * @param u The left vector of the rank-one update.
+         * @param v The right vector of the rank-one update.
+         */
+        void updateFactors(const VECTOR_T& u, const VECTOR_T& v)
+        {
+            using namespace blaze;
+            using std::hypot;
+
+            const size_t n = m_R.rows();
+            VECTOR_T     w = trans(m_Q) * u;
+
+            // Reduce w to a multiple of e_1; this turns R into an upper Hessenberg matrix.
+            for (size_t k = n - 1; k > 0; --k) {
+                const RES_T r = hypot(w[k - 1], w[k]);
+                if (r == RES_T {}) continue;
+                const RES_T c = w[k - 1] / r;
+                const RES_T s = w[k] / r;
+                rotate(k - 1, k, k - 1, c, s);
+                w[k - 1] = r;
+                w[k]     = RES_T {};
+            }
+
+            // Add the rank-one term, which now only affects the first row of R.
+            for (size_t col = 0; col < n; ++col) m_R(0, col) += w[0] * v[col];
+
+            // Restore the upper triangular form of R.
+            for (size_t k = 0; k + 1 < n; ++k) {
+                const RES_T r = hypot(m_R(k, k), m_R(k + 1, k));
+                if (r == RES_T {}) continue;
+                rotate(k, k + 1, k, m_R(k, k) / r, m_R(k + 1, k) / r);
+                m_R(k + 1, k) = RES_T {};
+            }
+        }
+    };
+
+    /**
+     * @brief Deduction guide for Broyden with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    Broyden(FUNCTION_T, ARR_T) -> Broyden< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
 
-            // Begin iteration loop.
-            int iter = 1;
+    /**
+     * @brief Deduction guide for Broyden with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    Broyden(FUNCTION_T, std::initializer_list< ARG_T >) -> Broyden< FUNCTION_T, ARG_T >;
+
+    /**
+     * @class BroydenBad
+     * @brief Template class implementing Broyden's "bad" quasi-Newton method for multi-root solving.
+     *
+     * @details As opposed to the "good" method, the "bad" method approximates the inverse of the Jacobian directly,
+     *          H_{k+1} = H_k + (s - H_k*y)*y^T / (y^T*y), which minimizes the change in H rather than in B. The
+     *          Jacobian is computed and inverted only once, for the initial guess; subsequently, each iteration requires
+     *          a single evaluation of the functions and two matrix-vector products, i.e. O(N^2) operations.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class BroydenBad final : public detail::MultirootBase< BroydenBad< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
+    {
+        using BASE     = detail::MultirootBase< BroydenBad< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T >;
+
+        MATRIX_T m_H {}; /**< The approximation of the inverse Jacobian. */
+
+    public:
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Overloaded function call operator implementing the Broyden iteration step.
+         * @details This method computes the step dx = -H * f(x), updates the root estimate, and applies the
+         *          rank-one update to the inverse Jacobian approximation.
+         */
+        void operator()()
+        {
+            using namespace blaze;
+            using namespace nxx::deriv;
+
+            if (m_H.rows() == 0) m_H = inv(jacobian(BASE::m_functions, BASE::m_guess));
+
+            const VECTOR_T step = -(m_H * BASE::m_fval);
+            BASE::m_guess += step;
+
+            VECTOR_T       fval = BASE::evaluate(BASE::m_guess);
+            const VECTOR_T y    = fval - BASE::m_fval;
+            BASE::m_fval        = std::move(fval);
+
+            const RES_T yty = dot(y, y);
+            if (yty > 0) {
+                const VECTOR_T u = (step - m_H * y) / yty;
+                m_H += u * trans(y);
+            }
+        }
+    };
+
+    /**
+     * @brief Deduction guide for BroydenBad with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    BroydenBad(FUNCTION_T, ARR_T) -> BroydenBad< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for BroydenBad with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    BroydenBad(FUNCTION_T, std::initializer_list< ARG_T >) -> BroydenBad< FUNCTION_T, ARG_T >;
+
+    // =================================================================================================================
+    //
+    // 88888888ba,                              88
+    // 88      `"8b                             88
+    // 88        `8b                            88
+    // 88         88   ,adPPYba,    ,adPPYb,d8  88   ,adPPYba,   ,adPPYb,d8
+    // 88         88  a8"     "8a  a8"    `Y88  88  a8P_____88  a8"    `Y88
+    // 88         8P  8b       d8  8b       88  88  8PP"""""""  8b       88
+    // 88      .a8P   "8a,   ,a8"  "8a,   ,d88  88  "8b,   ,aa  "8a,   ,d88
+    // 88888888Y"'     `"YbbdP"'    `"YbbdP"Y8  88   `"Ybbd8"'   `"YbbdP"Y8
+    //                              aa,    ,88                   aa,    ,88
+    //                               "Y8bbdP"                     "Y8bbdP"
+    //
+    // =================================================================================================================
+
+    /**
+     * @class Dogleg
+     * @brief Template class implementing Powell's dogleg trust-region method for multi-root solving.
+     *
+     * @details In each iteration, the step is chosen along the dogleg path from the Cauchy point (the minimizer of the
+     *          linear model along the steepest descent direction of ||f||^2) to the Gauss-Newton point, restricted to
+     *          a trust region. The step is accepted if the actual reduction of ||f||^2 is a sufficient fraction of the
+     *          reduction predicted by the linear model, and the trust region radius is adapted accordingly. If the
+     *          step is rejected, the radius is reduced and a new step is computed using the same Jacobian, QR
+     *          factorization and function values; hence, a rejected step costs a single function evaluation.
+     *          Unlike MultiNewton, the method converges from poor initial guesses.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class Dogleg final : public detail::MultirootBase< Dogleg< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
+    {
+        using BASE     = detail::MultirootBase< Dogleg< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T >;
+
+        MATRIX_T m_jac {};    /**< The Jacobian at the current guess. */
+        VECTOR_T m_newton {}; /**< The Gauss-Newton step at the current guess. */
+        VECTOR_T m_cauchy {}; /**< The step to the Cauchy point at the current guess. */
+        RES_T    m_radius {}; /**< The trust region radius. */
+
+    public:
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Overloaded function call operator implementing the dogleg iteration step.
+         * @details This method computes trial steps, shrinking the trust region as required, until a step is accepted
+         *          (or the trust region has collapsed), and then updates the root estimate and the Jacobian.
+         */
+        void operator()()
+        {
+            using namespace blaze;
+            using std::isfinite;
+            using std::max;
+
+            if (m_jac.rows() == 0) {
+                m_radius = 100 * max(RES_T { norm(BASE::m_guess) }, RES_T { 1.0 });
+                updateJacobian();
+            }
+
+            const RES_T fnorm2 = sqrNorm(BASE::m_fval);
             while (true) {
-                result = solver.current();
+                const VECTOR_T step  = computeStep();
+                const RES_T    snorm = norm(step);
+
+                const VECTOR_T trial  = BASE::m_guess + step;
+                VECTOR_T       ftrial = BASE::evaluate(trial);
+
+                const VECTOR_T model     = BASE::m_fval + m_jac * step;
+                const RES_T    predicted = fnorm2 - sqrNorm(model);
+                const RES_T    ratio     = predicted > 0 ? (fnorm2 - sqrNorm(ftrial)) / predicted : RES_T {};
+
+                // A non-finite residual at the trial point (i.e. a NaN ratio) rejects the step, like a poor ratio.
+                if (!(ratio >= 0.25))
+                    m_radius = 0.25 * (isfinite(snorm) ? snorm : m_radius);
+                else if (ratio > 0.75 && snorm >= 0.99 * m_radius)
+                    m_radius = 2 * m_radius;
+
+                if (ratio > 1.0E-4) {
+                    BASE::m_guess = trial;
+                    BASE::m_fval  = std::move(ftrial);
+                    updateJacobian();
+                    return;
+                }
 
-                // Check for NaN or Inf
-                if (!std::isfinite(norm(solver.evaluate(*result)))) {
-                    result = tl::make_unexpected(ERROR_T("Non-finite result!"));
-                    return result;
+                if (!(m_radius > std::numeric_limits< RES_T >::epsilon() * max(RES_T { norm(BASE::m_guess) }, RES_T { 1.0 }))) return;
+            }
+        }
+
+    private:
+        /**
+         * @brief Computes the Jacobian at the current guess, and the Gauss-Newton and Cauchy steps, which are
+         *        reused for all trial steps until a step is accepted.
+         */
+        void updateJacobian()
+        {
+            using namespace blaze;
+            using namespace nxx::deriv;
+
+            m_jac = jacobian(BASE::m_functions, BASE::m_guess);
+
+            MATRIX_T Q;
+            MATRIX_T R;
+            qr(m_jac, Q, R);
+            m_newton = detail::solveUpperTriangular(R, VECTOR_T(-(trans(Q) * BASE::m_fval)));
+
+            const VECTOR_T gradient = trans(m_jac) * BASE::m_fval;
+            const VECTOR_T jg       = m_jac * gradient;
+            const RES_T    jgnorm2  = sqrNorm(jg);
+            m_cauchy                = jgnorm2 > 0 ? VECTOR_T(-(sqrNorm(gradient) / jgnorm2) * gradient) : VECTOR_T(gradient.size(), RES_T {});
+        }
+
+        /**
+         * @brief Computes the dogleg step for the current trust region radius.
+         * @return The step.
+         */
+        VECTOR_T computeStep() const
+        {
+            using namespace blaze;
+            using std::isfinite;
+            using std::sqrt;
+
+            // A singular Jacobian gives a non-finite Gauss-Newton step; in that case, follow the steepest descent direction.
+            const RES_T nnorm = norm(m_newton);
+            if (isfinite(nnorm) && nnorm <= m_radius) return m_newton;
+
+            const RES_T cnorm = norm(m_cauchy);
+            if (!isfinite(nnorm) || cnorm >= m_radius) return cnorm > 0 ? VECTOR_T((m_radius / cnorm) * m_cauchy) : m_cauchy;
+
+            // Find tau, such that ||cauchy + tau * (newton - cauchy)|| = radius.
+            const VECTOR_T diff = m_newton - m_cauchy;
+            const RES_T    a    = sqrNorm(diff);
+            const RES_T    b    = 2 * dot(m_cauchy, diff);
+            const RES_T    c    = cnorm * cnorm - m_radius * m_radius;
+            const RES_T    tau  = (-b + sqrt(b * b - 4 * a * c)) / (2 * a);
+
+            return m_cauchy + tau * diff;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for Dogleg with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    Dogleg(FUNCTION_T, ARR_T) -> Dogleg< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for Dogleg with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    Dogleg(FUNCTION_T, std::initializer_list< ARG_T >) -> Dogleg< FUNCTION_T, ARG_T >;
+
+    // =================================================================================================================
+    //
+    // 88                                    88b           d88
+    // 88                                    888b         d888
+    // 88                                    88`8b       d8'88
+    // 88            ,adPPYba,  8b       d8  88 `8b     d8' 88  ,adPPYYba,  8b,dPPYba,
+    // 88           a8P_____88  `8b     d8'  88  `8b   d8'  88  ""     `Y8  88P'   "Y8
+    // 88           8PP"""""""   `8b   d8'   88   `8b d8'   88  ,adPPPPP88  88
+    // 88           "8b,   ,aa    `8b,d8'    88    `888'    88  88,    ,88  88
+    // 88888888888   `"Ybbd8"'      "8"      88     `8'     88  `"8bbdP"Y8  88
+    //
+    // =================================================================================================================
+
+    /**
+     * @class LevenbergMarquardt
+     * @brief Template class implementing the Levenberg-Marquardt method for multi-root solving.
+     *
+     * @details In each iteration, the damped normal equations (J^T*J + mu*I) * dx = -J^T*f(x) are solved using a
+     *          Cholesky factorization. The damping parameter mu interpolates between the Gauss-Newton step (small mu)
+     *          and a short steepest descent step (large mu), and is adapted according to the ratio of the actual and
+     *          the predicted reduction of ||f||^2 (using the strategy by Nielsen). If a step is rejected, the damping
+     *          is increased and a new step is computed using the same J^T*J, J^T*f and function values; hence, a
+     *          rejected step costs a single function evaluation and a Cholesky factorization.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class LevenbergMarquardt final
+        : public detail::MultirootBase< LevenbergMarquardt< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
+    {
+        using BASE     = detail::MultirootBase< LevenbergMarquardt< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T >;
+
+        MATRIX_T m_jtj {};      /**< J^T*J at the current guess. */
+        VECTOR_T m_gradient {}; /**< J^T*f at the current guess. */
+        RES_T    m_mu {};       /**< The damping parameter. */
+        RES_T    m_nu { 2.0 };  /**< The factor by which the damping parameter is increased after a rejected step. */
+
+        static constexpr double MaxDampingFactor = 1.0E3; /**< The upper bound for m_nu. */
+
+    public:
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Overloaded function call operator implementing the Levenberg-Marquardt iteration step.
+         * @details This method computes trial steps, increasing the damping as required, until a step is accepted
+         *          (or the step has become negligible), and then updates the root estimate and the Jacobian.
+         */
+        void operator()()
+        {
+            using namespace blaze;
+            using std::isfinite;
+            using std::max;
+            using std::min;
+            using std::pow;
+
+            if (m_jtj.rows() == 0) {
+                updateJacobian();
+
+                RES_T maxdiag {};
+                for (size_t i = 0; i < m_jtj.rows(); ++i) maxdiag = max(maxdiag, m_jtj(i, i));
+                m_mu = 1.0E-3 * (maxdiag > 0 ? maxdiag : RES_T { 1.0 });
+            }
+
+            const RES_T fnorm2 = sqrNorm(BASE::m_fval);
+            while (true) {
+                MATRIX_T A = m_jtj;
+                for (size_t i = 0; i < A.rows(); ++i) A(i, i) += m_mu;
+
+                MATRIX_T L;
+                llh(A, L);
+                const VECTOR_T step = -detail::solveCholesky(L, m_gradient);
+
+                const VECTOR_T trial  = BASE::m_guess + step;
+                VECTOR_T       ftrial = BASE::evaluate(trial);
+
+                // The reduction of ||f||^2 predicted by the linear model is step^T * (mu * step - J^T*f).
+                const RES_T predicted = dot(step, VECTOR_T(m_mu * step - m_gradient));
+                const RES_T ratio     = predicted > 0 ? (fnorm2 - sqrNorm(ftrial)) / predicted : RES_T {};
+
+                if (ratio > 0) {
+                    BASE::m_guess = trial;
+                    BASE::m_fval  = std::move(ftrial);
+                    updateJacobian();
+                    m_mu *= max(RES_T { 1.0 / 3.0 }, RES_T { 1 - pow(2 * ratio - 1, 3) });
+                    m_nu = 2.0;
+                    return;
                 }
 
-                // Check for convergence
-                if (norm(solver.evaluate(*result)) < eps) {
-                    std::cout << "Converged after " << iter << " iterations." << std::endl;
-                    break;
+                m_mu *= m_nu;
+                m_nu = min(2 * m_nu, RES_T { MaxDampingFactor });
+
+                // After many rejections (e.g. due to non-finite residuals at the trial points), the damping overflows,
+                // and the step becomes zero or NaN; in either case, give up on this iteration.
+                if (!isfinite(m_mu)) return;
+                if (!(norm(step) > std::numeric_limits< RES_T >::epsilon() * max(RES_T { norm(BASE::m_guess) }, RES_T { 1.0 }))) return;
+            }
+        }
+
+    private:
+        /**
+         * @brief Computes J^T*J and J^T*f at the current guess, which are reused for all trial steps until a step is accepted.
+         */
+        void updateJacobian()
+        {
+            using namespace blaze;
+            using namespace nxx::deriv;
+
+            const MATRIX_T jac = jacobian(BASE::m_functions, BASE::m_guess);
+            m_jtj              = trans(jac) * jac;
+            m_gradient         = trans(jac) * BASE::m_fval;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for LevenbergMarquardt with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    LevenbergMarquardt(FUNCTION_T, ARR_T) -> LevenbergMarquardt< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for LevenbergMarquardt with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    LevenbergMarquardt(FUNCTION_T, std::initializer_list< ARG_T >) -> LevenbergMarquardt< FUNCTION_T, ARG_T >;
+
+    // =================================================================================================================
+    //
+    // 88      a8P                            88
+    // 88    ,88'                             88
+    // 88  ,88"                               88
+    // 88,d88'       8b,dPPYba,  8b       d8  88   ,adPPYba,   8b       d8
+    // 8888"88,      88P'   "Y8  `8b     d8'  88  a8"     "8a  `8b     d8'
+    // 88P   Y8b     88           `8b   d8'   88  8b       d8   `8b   d8'
+    // 88     "88,   88            `8b,d8'    88  "8a,   ,a8"    `8b,d8'
+    // 88       Y8b  88              Y88'     88   `"YbbdP"'       "8"
+    //                               d8'
+    //                              d8'
+    //
+    // =================================================================================================================
+
+    /**
+     * @class NewtonKrylov
+     * @brief Template class implementing the Jacobian-free Newton-Krylov method for multi-root solving.
+     *
+     * @details In each iteration, the Newton equations J * dx = -f(x) are solved inexactly, using restarted GMRES(m).
+     *          The Jacobian is never formed; instead, the products J * v required by GMRES are approximated by
+     *          directional finite differences (see `deriv::jvp`), each requiring a single evaluation of the functions.
+     *          Hence, the memory requirements scale with N * m rather than N^2, which makes the method suitable for
+     *          large systems. The linear solve is terminated when ||J * dx + f(x)|| <= eta * ||f(x)||, where the forcing
+     *          term eta is chosen using the second strategy by Eisenstat and Walker; i.e. the Newton equations are
+     *          solved loosely far from the root, and increasingly accurately as the root is approached. Optionally, a
+     *          preconditioner approximating J^-1 may be supplied, which is applied from the right.
+     *
+     *          If the system carries an analytic Jacobian (see `HasJacobian`), it is computed once per iteration, and
+     *          the products J * v are exact matrix-vector products instead; the memory then scales with N^2.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class NewtonKrylov final : public detail::MultirootBase< NewtonKrylov< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
+    {
+        using BASE     = detail::MultirootBase< NewtonKrylov< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T >;
+
+    public:
+        /**
+         * @brief The type of the preconditioner, computing an approximation of J(x)^-1 * v, given the point x and the vector v.
+         */
+        using PRECONDITIONER_T = std::function< VECTOR_T(const VECTOR_T&, const VECTOR_T&) >;
+
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a preconditioner.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param preconditioner A callable computing an approximation of J(x)^-1 * v; may be empty.
+         * @param restart The dimension of the Krylov subspace, after which GMRES is restarted.
+         */
+        template< typename ARR >
+        NewtonKrylov(const FUNCTION_T& functions, const ARR& guess, PRECONDITIONER_T preconditioner, size_t restart = 30)
+            : BASE(functions, guess),
+              m_preconditioner { std::move(preconditioner) },
+              m_restart { restart }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and a preconditioner.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param preconditioner A callable computing an approximation of J(x)^-1 * v; may be empty.
+         * @param restart The dimension of the Krylov subspace, after which GMRES is restarted.
+         */
+        NewtonKrylov(const FUNCTION_T&              functions,
+                     std::initializer_list< ARG_T > guess,
+                     PRECONDITIONER_T               preconditioner,
+                     size_t                         restart = 30)
+            : BASE(functions, guess),
+              m_preconditioner { std::move(preconditioner) },
+              m_restart { restart }
+        {}
+
+        /**
+         * @brief Overloaded function call operator implementing the Newton-Krylov iteration step.
+         * @details This method updates the forcing term, solves the Newton equations inexactly using GMRES,
+         *          and updates the root estimate.
+         */
+        void operator()()
+        {
+            using namespace blaze;
+
+            const RES_T fnorm = norm(BASE::m_fval);
+            updateForcingTerm(fnorm);
+
+            BASE::m_guess += solveNewtonEquations(m_eta * fnorm);
+            BASE::evaluate(BASE::m_guess, BASE::m_fval);
+            m_fnorm = fnorm;
+        }
+
+    private:
+        PRECONDITIONER_T m_preconditioner {};  /**< Optional preconditioner; if empty, no preconditioning is applied. */
+        size_t           m_restart { 30 };     /**< The dimension of the Krylov subspace, after which GMRES is restarted. */
+        size_t           m_maxRestarts { 10 }; /**< The maximum number of GMRES cycles per Newton iteration. */
+        RES_T            m_eta { 0.5 };        /**< The forcing term, i.e. the relative tolerance of the linear solve. */
+        RES_T            m_fnorm {};           /**< The norm of the function values at the previous iterate. */
+
+        /**
+         * @brief Updates the forcing term, using choice 2 by Eisenstat and Walker, with gamma = 0.9 and alpha = 2.
+         * @details The safeguard prevents the forcing term from decreasing too rapidly, when the reduction of ||f||
+         *          in a single iteration happens to be large far from the root. The forcing term is kept above the
+         *          accuracy of the finite difference Jacobian-vector products, as it cannot be met anyway.
+         * @param fnorm The norm of the function values at the current iterate.
+         */
+        void updateForcingTerm(RES_T fnorm)
+        {
+            using std::max;
+            using std::min;
+            using std::sqrt;
+
+            if (m_fnorm == RES_T {}) return;
+
+            const RES_T gamma     = 0.9;
+            const RES_T eta       = gamma * (fnorm / m_fnorm) * (fnorm / m_fnorm);
+            const RES_T safeguard = gamma * m_eta * m_eta;
+
+            m_eta = min(RES_T { 0.9 }, safeguard > 0.1 ? max(eta, safeguard) : eta);
+            if constexpr (!HasJacobian< FUNCTION_T >) m_eta = max(m_eta, sqrt(std::numeric_limits< RES_T >::epsilon()));
+        }
+
+        /**
+         * @brief Applies the preconditioner, if any, to a vector.
+         */
+        VECTOR_T precondition(const VECTOR_T& vector) const { return m_preconditioner ? m_preconditioner(BASE::m_guess, vector) : vector; }
+
+        /**
+         * @brief Solves J * dx = -f(x), using right-preconditioned, restarted GMRES.
+         * @details The Arnoldi basis is orthogonalized using modified Gram-Schmidt, and the least squares problem is
+         *          solved incrementally, using Givens rotations, such that the norm of the linear residual is known
+         *          in each GMRES iteration without computing the step.
+         * @param tolerance The (absolute) tolerance for the norm of the linear residual.
+         * @return The (inexact) Newton step.
+         */
+        VECTOR_T solveNewtonEquations(RES_T tolerance) const
+        {
+            using namespace blaze;
+            using namespace nxx::deriv;
+            using std::abs;
+            using std::hypot;
+
+            const size_t n = BASE::m_guess.size();
+            const size_t m = std::max(std::min(m_restart, n), size_t { 1 });
+
+            std::vector< VECTOR_T > basis(m + 1);
+            MATRIX_T                hessenberg(m + 1, m, RES_T {});
+            VECTOR_T                cosines(m);
+            VECTOR_T                sines(m);
+
+            // With an analytic Jacobian, it is computed once, and the products are exact; otherwise, they are
+            // approximated by directional finite differences.
+            MATRIX_T jac;
+            if constexpr (HasJacobian< FUNCTION_T >) jac = jacobian(BASE::m_functions, BASE::m_guess);
+            auto product = [&](const VECTOR_T& v) -> VECTOR_T {
+                if constexpr (HasJacobian< FUNCTION_T >)
+                    return jac * v;
+                else
+                    return jvp(BASE::m_functions, BASE::m_guess, v, BASE::m_fval);
+            };
+
+            VECTOR_T step(n, RES_T {});
+            VECTOR_T residual = -BASE::m_fval;
+
+            for (size_t cycle = 0; cycle < m_maxRestarts; ++cycle) {
+                const RES_T beta = norm(residual);
+                if (beta <= tolerance) break;
+
+                basis[0] = residual / beta;
+                VECTOR_T g(m + 1, RES_T {});
+                g[0] = beta;
+
+                size_t k = 0;
+                while (k < m) {
+                    VECTOR_T w = product(precondition(basis[k]));
+
+                    for (size_t i = 0; i <= k; ++i) {
+                        hessenberg(i, k) = dot(w, basis[i]);
+                        w -= hessenberg(i, k) * basis[i];
+                    }
+                    hessenberg(k + 1, k) = norm(w);
+                    const bool breakdown = hessenberg(k + 1, k) == RES_T {};
+                    if (!breakdown) basis[k + 1] = w / hessenberg(k + 1, k);
+
+                    // Apply the previous rotations to the new column, and eliminate the subdiagonal element.
+                    for (size_t i = 0; i < k; ++i) {
+                        const RES_T a        = hessenberg(i, k);
+                        const RES_T b        = hessenberg(i + 1, k);
+                        hessenberg(i, k)     = cosines[i] * a + sines[i] * b;
+                        hessenberg(i + 1, k) = -sines[i] * a + cosines[i] * b;
+                    }
+                    const RES_T r        = hypot(hessenberg(k, k), hessenberg(k + 1, k));
+                    cosines[k]           = r > 0 ? hessenberg(k, k) / r : RES_T { 1.0 };
+                    sines[k]             = r > 0 ? hessenberg(k + 1, k) / r : RES_T {};
+                    hessenberg(k, k)     = r;
+                    hessenberg(k + 1, k) = RES_T {};
+                    g[k + 1]             = -sines[k] * g[k];
+                    g[k]                 = cosines[k] * g[k];
+
+                    ++k;
+                    if (breakdown || abs(g[k]) <= tolerance) break;
+                }
+
+                VECTOR_T y(k);
+                for (size_t i = 0; i < k; ++i) y[i] = g[i];
+                y = detail::solveUpperTriangular(hessenberg, y);
+
+                VECTOR_T update(n, RES_T {});
+                for (size_t i = 0; i < k; ++i) update += y[i] * basis[i];
+                step += precondition(update);
+
+                if (abs(g[k]) <= tolerance) break;
+                residual = -BASE::m_fval - product(step);
+            }
+
+            return step;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for NewtonKrylov with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    NewtonKrylov(FUNCTION_T, ARR_T) -> NewtonKrylov< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for NewtonKrylov with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    NewtonKrylov(FUNCTION_T, std::initializer_list< ARG_T >) -> NewtonKrylov< FUNCTION_T, ARG_T >;
+
+    /**
+     * @brief Deduction guide for NewtonKrylov with a function array or system, an arbitrary container type and a preconditioner.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     * @tparam PREC_T The type of the preconditioner.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T, typename PREC_T >
+    NewtonKrylov(FUNCTION_T, ARR_T, PREC_T, size_t = 30) -> NewtonKrylov< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for NewtonKrylov with a function array or system, an initializer list and a preconditioner.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     * @tparam PREC_T The type of the preconditioner.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T, typename PREC_T >
+    NewtonKrylov(FUNCTION_T, std::initializer_list< ARG_T >, PREC_T, size_t = 30) -> NewtonKrylov< FUNCTION_T, ARG_T >;
+
+    // =================================================================================================================
+    //
+    //         db                            88
+    //        d88b                           88
+    //       d8'`8b                          88
+    //      d8'  `8b      8b,dPPYba,   ,adPPYb,88   ,adPPYba,  8b,dPPYba,  ,adPPYba,   ,adPPYba,   8b,dPPYba,
+    //     d8YaaaaY8b     88P'   `"8a a8"    `Y88  a8P_____88  88P'   "Y8  I8[    ""  a8"     "8a  88P'   `"8a
+    //    d8""""""""8b    88       88 8b       88  8PP"""""""  88           `"Y8ba,   8b       d8  88       88
+    //   d8'        `8b   88       88 "8a,   ,d88  "8b,   ,aa  88          aa    ]8I  "8a,   ,a8"  88       88
+    //  d8'          `8b  88       88  `"8bbdP"Y8   `"Ybbd8"'  88          `"YbbdP"'   `"YbbdP"'   88       88
+    //
+    // =================================================================================================================
+
+    /**
+     * @class Anderson
+     * @brief Template class implementing Anderson mixing (Anderson acceleration) for multi-root solving.
+     *
+     * @details The solver accelerates the fixed-point iteration x <- g(x) = x + beta * f(x), where beta is the mixing
+     *          parameter. Hence, to solve a fixed-point problem x = g(x), pass the residual f(x) = g(x) - x; with the
+     *          default mixing of one, the plain iteration is then x <- g(x). The last (at most) `depth` differences of
+     *          the function values and of the plain iterates are stored, and the next iterate is the combination of
+     *          the plain iterates that minimizes the linearized residual, found by solving a small least-squares
+     *          problem by QR factorization. No Jacobian is needed, and each iteration requires a single evaluation of
+     *          the functions. If the stored differences become (nearly) linearly dependent, the oldest are discarded.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments used for initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    class Anderson final : public detail::MultirootBase< Anderson< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >
+    {
+        using BASE     = detail::MultirootBase< Anderson< FUNCTION_T, ARG_T >, FUNCTION_T, ARG_T >;
+        using RES_T    = typename BASE::RES_T;
+        using VECTOR_T = blaze::DynamicVector< RES_T >;
+        using MATRIX_T = blaze::DynamicMatrix< RES_T >;
+
+        std::deque< VECTOR_T > m_dF {};           /**< Differences between consecutive function values. */
+        std::deque< VECTOR_T > m_dG {};           /**< Differences between consecutive plain iterates. */
+        VECTOR_T               m_prevF {};        /**< The function values at the previous iterate. */
+        VECTOR_T               m_prevG {};        /**< The plain iterate computed from the previous iterate. */
+        size_t                 m_depth { 5 };     /**< The maximum number of stored differences. */
+        RES_T                  m_mixing { 1.0 };  /**< The mixing parameter, beta. */
+
+    public:
+        /**
+         * @brief Inherits constructors from the base class MultirootBase.
+         */
+        using BASE::BASE;
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and the mixing parameters.
+         * @tparam ARR Container type for the initial guess.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots.
+         * @param depth The maximum number of stored differences; zero gives the plain fixed-point iteration.
+         * @param mixing The mixing parameter, beta.
+         */
+        template< typename ARR >
+        Anderson(const FUNCTION_T& functions, const ARR& guess, size_t depth, RES_T mixing = 1.0)
+            : BASE(functions, guess),
+              m_depth { depth },
+              m_mixing { mixing }
+        {}
+
+        /**
+         * @brief Constructor initializing the solver with functions, an initial guess and the mixing parameters.
+         * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+         * @param guess Initial guess for the roots provided as an initializer list.
+         * @param depth The maximum number of stored differences; zero gives the plain fixed-point iteration.
+         * @param mixing The mixing parameter, beta.
+         */
+        Anderson(const FUNCTION_T& functions, std::initializer_list< ARG_T > guess, size_t depth, RES_T mixing = 1.0)
+            : BASE(functions, guess),
+              m_depth { depth },
+              m_mixing { mixing }
+        {}
+
+        /**
+         * @brief Overloaded function call operator implementing the Anderson iteration step.
+         * @details This method computes the plain iterate g = x + beta * f(x), updates the stored differences, and
+         *          finds gamma minimizing ||f(x) - dF * gamma||. The next iterate is g - dG * gamma.
+         */
+        void operator()()
+        {
+            using namespace blaze;
+
+            const VECTOR_T fval = BASE::m_fval;
+            VECTOR_T       next = BASE::m_guess + m_mixing * fval;
+
+            if (m_depth > 0) {
+                if (m_prevF.size() == fval.size()) {
+                    m_dF.push_back(fval - m_prevF);
+                    m_dG.push_back(next - m_prevG);
+                    if (m_dF.size() > m_depth) {
+                        m_dF.pop_front();
+                        m_dG.pop_front();
+                    }
                 }
+                m_prevF = fval;
+                m_prevG = next;
 
-                if (iter >= maxiter) {
-                    std::cout << "Maximum number of iterations exceeded: " << maxiter << std::endl;
-                    break;
+                const VECTOR_T gamma = solveLeastSquares(fval);
+                for (size_t j = 0; j < gamma.size(); ++j) next -= gamma[j] * m_dG[j];
+            }
+
+            BASE::m_guess = next;
+            BASE::evaluate(BASE::m_guess, BASE::m_fval);
+        }
+
+    private:
+        /**
+         * @brief Solves the least-squares problem min ||f - dF * gamma|| by modified Gram-Schmidt QR factorization.
+         * @details If a column of dF is (nearly) a linear combination of the others, the oldest differences are
+         *          discarded, and the factorization is restarted.
+         * @param f The function values at the current iterate.
+         * @return The coefficients gamma; empty if no differences are stored.
+         */
+        VECTOR_T solveLeastSquares(const VECTOR_T& f)
+        {
+            using namespace blaze;
+
+            while (!m_dF.empty()) {
+                const size_t            m = m_dF.size();
+                std::vector< VECTOR_T > Q(m_dF.begin(), m_dF.end());
+                MATRIX_T                R(m, m, RES_T {});
+                bool                    dependent = false;
+
+                for (size_t j = 0; j < m && !dependent; ++j) {
+                    const RES_T original = norm(Q[j]);
+                    for (size_t i = 0; i < j; ++i) {
+                        R(i, j) = dot(Q[i], Q[j]);
+                        Q[j] -= R(i, j) * Q[i];
+                    }
+                    R(j, j)   = norm(Q[j]);
+                    dependent = !(R(j, j) > std::sqrt(std::numeric_limits< RES_T >::epsilon()) * original);
+                    if (!dependent) Q[j] /= R(j, j);
+                }
+
+                if (dependent) {
+                    m_dF.pop_front();
+                    m_dG.pop_front();
+                    continue;
                 }
 
+                VECTOR_T qtf(m);
+                for (size_t i = 0; i < m; ++i) qtf[i] = dot(Q[i], f);
+                return detail::solveUpperTriangular(R, std::move(qtf));
+            }
+
+            return VECTOR_T {};
+        }
+    };
+
+    /**
+     * @brief Deduction guide for Anderson with a function array or system and an arbitrary container type.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T >
+    Anderson(FUNCTION_T, ARR_T) -> Anderson< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for Anderson with a function array or system and an initializer list.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T >
+    Anderson(FUNCTION_T, std::initializer_list< ARG_T >) -> Anderson< FUNCTION_T, ARG_T >;
+
+    /**
+     * @brief Deduction guide for Anderson with a function array or system, an arbitrary container type and mixing parameters.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARR_T The container type for the initial guess.
+     */
+    template< IsMultiFunction FUNCTION_T, typename ARR_T, typename... ARGS_T >
+    Anderson(FUNCTION_T, ARR_T, size_t, ARGS_T...) -> Anderson< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
+
+    /**
+     * @brief Deduction guide for Anderson with a function array or system, an initializer list and mixing parameters.
+     * @tparam FUNCTION_T The type of the functions.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     */
+    template< IsMultiFunction FUNCTION_T, IsFloat ARG_T, typename... ARGS_T >
+    Anderson(FUNCTION_T, std::initializer_list< ARG_T >, size_t, ARGS_T...) -> Anderson< FUNCTION_T, ARG_T >;
+
+    // =================================================================================================================
+    //
+    //                                  88           88                          88
+    //                                  88    ,d     ""                          88
+    //                                  88    88                                 88
+    // 88,dPYba,,adPYba,   88       88  88  MM88MMM  88  ,adPPYba,   ,adPPYba,   88  8b       d8   ,adPPYba,
+    // 88P'   "88"    "8a  88       88  88    88     88  I8[    ""  a8"     "8a  88  `8b     d8'  a8P_____88
+    // 88      88      88  88       88  88    88     88   `"Y8ba,   8b       d8  88   `8b   d8'   8PP"""""""
+    // 88      88      88  "8a,   ,a88  88    88,    88  aa    ]8I  "8a,   ,a8"  88    `8b,d8'    "8b,   ,aa
+    // 88      88      88   `"YbbdP'Y8  88    "Y888  88  `"YbbdP"'   `"YbbdP"'   88      "8"       `"Ybbd8"'
+    //
+    //
+    // =================================================================================================================
+
+    /**
+     * @brief The result of solving a system of equations using multisolve.
+     * @tparam T The value type of the root estimate.
+     * @tparam VECTOR_T The type of the root estimate; a fixed-size vector for systems with a size known at compile time.
+     */
+    template< IsFloat T, typename VECTOR_T = blaze::DynamicVector< T > >
+    struct MultirootResult
+    {
+        VECTOR_T root {};       ///< The final estimate of the root.
+        T        residual {};   ///< The norm of the function values at the final estimate.
+        int      iterations {}; ///< The number of iterations performed.
+        bool     converged {};  ///< Whether the residual is below the tolerance.
+    };
+
+    namespace detail
+    {
+
+        /**
+         * @brief Solves multi-root problems using a given solver.
+         * @details This function iteratively applies the solver to find the roots of a system of equations,
+         *          and checks for convergence or non-finite results. The function values at each iterate are
+         *          computed once, by the solver, and shared with the computation of the next step.
+         *          If the maximum number of iterations is reached, the final estimate is returned with the
+         *          `converged` flag set to false, so that it can be used as the initial guess for another solver.
+         * @tparam SOLVER The type of the solver, which must conform to the MultirootSolver interface.
+         * @param solver An instance of the solver.
+         * @param eps The convergence tolerance.
+         * @param maxiter The maximum number of iterations allowed.
+         * @return tl::expected<RESULT_T, ERROR_T> A tl::expected object containing a MultirootResult
+         *         or an error if a non-finite result was encountered.
+         */
+        template< typename SOLVER >
+        requires SOLVER::IsMultirootSolver
+        auto multisolve_impl(SOLVER solver, IsFloat auto eps, std::integral auto maxiter)
+        {
+            using ERROR_T  = std::runtime_error;
+            using RESULT_T = MultirootResult< typename SOLVER::return_type, typename SOLVER::RETURN_T >;
+            using RETURN_T = tl::expected< RESULT_T, ERROR_T >;
+
+            int iter = 0;
+            while (true) {
+                using std::isfinite;
+                const auto residual = norm(solver.residual());
+
+                // Check for NaN or Inf
+                if (!isfinite(residual)) return RETURN_T(tl::make_unexpected(ERROR_T("Non-finite result!")));
+
+                // Check for convergence or exceeding the maximum number of iterations.
+                if (residual < eps || iter >= maxiter) return RETURN_T(RESULT_T { solver.current(), residual, iter, residual < eps });
+
+                // Solvers with a line search leave the estimate unchanged if the search failed; iterating further would repeat it.
+                if constexpr (requires { solver.searchFailed(); })
+                    if (solver.searchFailed()) return RETURN_T(tl::make_unexpected(ERROR_T("Line search failed to reduce the residual!")));
+
                 // Perform one iteration
                 ++iter;
                 solver.iterate();
             }
-
-            return result;
         }
     }    // namespace detail
 
@@ -508,29 +2241,27 @@ namespace nxx::multiroots
      * @brief Solves multi-root problems using a specified solver template, functions, and an initial guess.
      * @details This function template creates a solver instance and calls the multisolve_impl function to find roots.
      * @tparam SOLVER_T Template class of the solver.
-     * @tparam RES_T The return type of the functions used in the solver.
-     * @tparam PARAM_T The parameter type of the functions used in the solver.
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
      * @tparam ARR_T Container type for the initial guess.
      * @tparam EPS_T Floating point type for the convergence tolerance.
      * @tparam ITER_T Integral type for the maximum number of iterations.
-     * @param functions A MultiFunctionArray object containing the functions for root solving.
+     * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
      * @param guess Initial guess for the roots.
      * @param eps Convergence tolerance.
      * @param maxiter Maximum number of iterations.
      * @return An instance of tl::expected containing the result or an error.
      */
-    template< template< typename, typename, typename > class SOLVER_T,
-              IsFloat RES_T,
-              IsFloat PARAM_T,
+    template< template< typename, typename > class SOLVER_T,
+              IsMultiFunction FUNCTION_T,
               typename ARR_T,    // change to IsContainer??
               IsFloat       EPS_T  = traits::ContainerValueType_t< ARR_T >,
               std::integral ITER_T = int >
-    auto multisolve(MultiFunctionArray< RES_T, PARAM_T > functions,
-                    ARR_T                                guess,
-                    EPS_T                                eps     = epsilon< traits::ContainerValueType_t< ARR_T > >(),
-                    ITER_T                               maxiter = iterations< traits::ContainerValueType_t< ARR_T > >())
+    auto multisolve(FUNCTION_T functions,
+                    ARR_T      guess,
+                    EPS_T      eps     = epsilon< traits::ContainerValueType_t< ARR_T > >(),
+                    ITER_T     maxiter = iterations< traits::ContainerValueType_t< ARR_T > >())
     {
-        using SOLVER = SOLVER_T< RES_T, PARAM_T, traits::ContainerValueType_t< ARR_T > >;
+        using SOLVER = SOLVER_T< FUNCTION_T, traits::ContainerValueType_t< ARR_T > >;
         return detail::multisolve_impl(SOLVER(functions, guess), eps, maxiter);
     }
 
@@ -538,32 +2269,121 @@ namespace nxx::multiroots
      * @brief Solves multi-root problems using a specified solver template, functions, and an initializer list as the guess.
      * @details This function template creates a solver instance and calls the multisolve_impl function to find roots.
      * @tparam SOLVER_T Template class of the solver.
-     * @tparam RES_T The return type of the functions used in the solver.
-     * @tparam PARAM_T The parameter type of the functions used in the solver.
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
      * @tparam ARG_T The type of the arguments in the initializer list.
      * @tparam EPS_T Floating point type for the convergence tolerance.
      * @tparam ITER_T Integral type for the maximum number of iterations.
-     * @param functions A MultiFunctionArray object containing the functions for root solving.
+     * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
      * @param guess Initial guess for the roots provided as an initializer list.
      * @param eps Convergence tolerance.
      * @param maxiter Maximum number of iterations.
      * @return An instance of tl::expected containing the result or an error.
      */
-    template< template< typename, typename, typename > class SOLVER_T,
-              IsFloat       RES_T,
-              IsFloat       PARAM_T,
-              IsFloat       ARG_T,
-              IsFloat       EPS_T  = ARG_T,
-              std::integral ITER_T = int >
-    auto multisolve(MultiFunctionArray< RES_T, PARAM_T > functions,
-                    std::initializer_list< ARG_T >       guess,
-                    EPS_T                                eps     = epsilon< ARG_T >(),
-                    ITER_T                               maxiter = iterations< ARG_T >())
+    template< template< typename, typename > class SOLVER_T,
+              IsMultiFunction FUNCTION_T,
+              IsFloat         ARG_T,
+              IsFloat         EPS_T  = ARG_T,
+              std::integral   ITER_T = int >
+    auto multisolve(FUNCTION_T                     functions,
+                    std::initializer_list< ARG_T > guess,
+                    EPS_T                          eps     = epsilon< ARG_T >(),
+                    ITER_T                         maxiter = iterations< ARG_T >())
     {
-        using SOLVER = SOLVER_T< RES_T, PARAM_T, ARG_T >;
+        using SOLVER = SOLVER_T< FUNCTION_T, ARG_T >;
         return detail::multisolve_impl(SOLVER(functions, guess), eps, maxiter);
     }
 
+    /**
+     * @brief Solves multi-root problems with N unknowns, using a specified solver template, functions, and an initial guess.
+     * @details The functions are wrapped in a StaticMultiFunction, so that the solver keeps its state in fixed-size
+     *          vectors and matrices on the stack. For small systems, e.g. `multisolve<MultiNewton, 3>(functions, guess)`,
+     *          this removes all heap allocations from the iterations. The root estimate is returned as a fixed-size vector.
+     *          Only solvers that support fixed-size systems (currently MultiNewton) are accepted.
+     * @tparam SOLVER_T Template class of the solver.
+     * @tparam N The number of unknowns (and equations) of the system.
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARR_T Container type for the initial guess.
+     * @tparam EPS_T Floating point type for the convergence tolerance.
+     * @tparam ITER_T Integral type for the maximum number of iterations.
+     * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+     * @param guess Initial guess for the roots; must have N elements.
+     * @param eps Convergence tolerance.
+     * @param maxiter Maximum number of iterations.
+     * @return An instance of tl::expected containing the result or an error.
+     * @throws NumerixxError If the size of the initial guess differs from N.
+     */
+    template< template< typename, typename > class SOLVER_T,
+              size_t          N,
+              IsMultiFunction FUNCTION_T,
+              typename ARR_T,
+              IsFloat       EPS_T  = traits::ContainerValueType_t< ARR_T >,
+              std::integral ITER_T = int >
+    requires detail::IsFixedSizeSolver< SOLVER_T< StaticMultiFunction< FUNCTION_T, N >, traits::ContainerValueType_t< ARR_T > > >
+    auto multisolve(FUNCTION_T functions,
+                    ARR_T      guess,
+                    EPS_T      eps     = epsilon< traits::ContainerValueType_t< ARR_T > >(),
+                    ITER_T     maxiter = iterations< traits::ContainerValueType_t< ARR_T > >())
+    {
+        using SYSTEM = StaticMultiFunction< FUNCTION_T, N >;
+        using SOLVER = SOLVER_T< SYSTEM, traits::ContainerValueType_t< ARR_T > >;
+        return detail::multisolve_impl(SOLVER(SYSTEM(std::move(functions)), guess), eps, maxiter);
+    }
+
+    /**
+     * @brief Solves multi-root problems with N unknowns, using a specified solver template, functions, and an initializer
+     *        list as the guess.
+     * @details See the overload taking a container as the initial guess.
+     * @tparam SOLVER_T Template class of the solver.
+     * @tparam N The number of unknowns (and equations) of the system.
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam ARG_T The type of the arguments in the initializer list.
+     * @tparam EPS_T Floating point type for the convergence tolerance.
+     * @tparam ITER_T Integral type for the maximum number of iterations.
+     * @param functions A MultiFunctionArray or MultiFunctionSystem object containing the functions for root solving.
+     * @param guess Initial guess for the roots provided as an initializer list; must have N elements.
+     * @param eps Convergence tolerance.
+     * @param maxiter Maximum number of iterations.
+     * @return An instance of tl::expected containing the result or an error.
+     * @throws NumerixxError If the size of the initial guess differs from N.
+     */
+    template< template< typename, typename > class SOLVER_T,
+              size_t          N,
+              IsMultiFunction FUNCTION_T,
+              IsFloat         ARG_T,
+              IsFloat         EPS_T  = ARG_T,
+              std::integral   ITER_T = int >
+    requires detail::IsFixedSizeSolver< SOLVER_T< StaticMultiFunction< FUNCTION_T, N >, ARG_T > >
+    auto multisolve(FUNCTION_T                     functions,
+                    std::initializer_list< ARG_T > guess,
+                    EPS_T                          eps     = epsilon< ARG_T >(),
+                    ITER_T                         maxiter = iterations< ARG_T >())
+    {
+        using SYSTEM = StaticMultiFunction< FUNCTION_T, N >;
+        using SOLVER = SOLVER_T< SYSTEM, ARG_T >;
+        return detail::multisolve_impl(SOLVER(SYSTEM(std::move(functions)), guess), eps, maxiter);
+    }
+
+    /**
+     * @brief Solves multi-root problems using a solver instance that has already been configured.
+     * @details This overload allows solvers to be customized before solving, e.g. by providing a
+     *          gradient provider to SteepestDescent.
+     * @tparam SOLVER The type of the solver, which must conform to the MultirootSolver interface.
+     * @tparam EPS_T Floating point type for the convergence tolerance.
+     * @tparam ITER_T Integral type for the maximum number of iterations.
+     * @param solver An instance of the solver.
+     * @param eps Convergence tolerance.
+     * @param maxiter Maximum number of iterations.
+     * @return An instance of tl::expected containing the result or an error.
+     */
+    template< typename SOLVER, IsFloat EPS_T = typename SOLVER::arg_type, std::integral ITER_T = int >
+    requires SOLVER::IsMultirootSolver
+    auto multisolve(SOLVER solver,
+                    EPS_T  eps     = epsilon< typename SOLVER::arg_type >(),
+                    ITER_T maxiter = iterations< typename SOLVER::arg_type >())
+    {
+        return detail::multisolve_impl(std::move(solver), eps, maxiter);
+    }
+
 }    // namespace nxx::multiroots
 
 #endif    // NUMERIXX_MULTIROOTS_IMPL_HPP
@@ -0,0 +1,294 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file MultirootsBatch.hpp
+ * @brief This file contains the multisolve_batch function, for solving many small, independent systems.
+ *
+ * The systems share the same equations, but differ in their parameters. The problems are solved in blocks
+ * of `BatchLanes` problems at a time, with the iterates, function values and Jacobians stored in
+ * structure-of-arrays layout, i.e. with the problem index as the fastest running index. Hence, the linear
+ * algebra of a Newton step is performed for all problems of a block at once, in loops that the compiler
+ * can vectorize across problems.
+ */
+
+#ifndef NUMERIXX_MULTIROOTSBATCH_HPP
+#define NUMERIXX_MULTIROOTSBATCH_HPP
+
+// ===== Numerixx Includes
+#include "MultiDerivatives.hpp"
+#include "Multiroots.hpp"
+#include <Constants.hpp>
+#include <Error.hpp>
+#include <ThreadPool.hpp>
+
+// ===== External Includes
+#include <blaze/Blaze.h>
+
+// ===== Standard Library Includes
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace nxx::multiroots
+{
+    namespace detail
+    {
+        /**
+         * @brief Indicates whether a solver supports batched solving; currently only MultiNewton does.
+         */
+        template< template< typename, typename > class SOLVER_T >
+        inline constexpr bool IsBatchSolver = false;
+
+        template<>
+        inline constexpr bool IsBatchSolver< MultiNewton > = true;
+
+        /**
+         * @brief The number of problems solved simultaneously in a block.
+         */
+        inline constexpr size_t BatchLanes = 8;
+
+        /**
+         * @brief The value type of the initial guesses for a batch of problems.
+         */
+        template< typename GUESSES_T >
+        using BatchValue_t = std::remove_cvref_t< decltype(std::declval< std::ranges::range_reference_t< const GUESSES_T > >()[0]) >;
+
+        /**
+         * @brief Solves a block of (at most BatchLanes) problems using Newton's method.
+         *
+         * @details The state of the block is kept in structure-of-arrays layout on the stack. The functions, and the
+         *          (finite difference) Jacobians, are evaluated one problem at a time, but the Gaussian elimination
+         *          and the update of the iterates run over all problems of the block in the innermost loops.
+         *          Problems that have converged, failed, or reached the maximum number of iterations are masked
+         *          out, by giving them an identity Jacobian and a zero right-hand side.
+         *
+         * @param system The system of equations, invocable as `system(x, params, f)`.
+         * @param params The parameters of all problems.
+         * @param guesses The initial guesses of all problems.
+         * @param results The results of all problems.
+         * @param first The index of the first problem of the block.
+         * @param count The number of problems in the block.
+         * @param eps The convergence tolerance.
+         * @param maxiter The maximum number of iterations.
+         */
+        template< size_t N, typename T, typename FN_T, typename PARAMS_T, typename GUESSES_T, typename RESULTS_T >
+        void multisolve_block(const FN_T&      system,
+                              const PARAMS_T&  params,
+                              const GUESSES_T& guesses,
+                              RESULTS_T&       results,
+                              size_t           first,
+                              size_t           count,
+                              T                eps,
+                              int              maxiter)
+        {
+            using std::abs;
+            using std::isfinite;
+            using std::sqrt;
+            using std::swap;
+            constexpr size_t L = BatchLanes;
+
+            T    x[N][L] {};       // Iterates
+            T    f[N][L] {};       // Function values; overwritten by the Newton steps
+            T    J[N][N][L] {};    // Jacobians
+            bool active[L] {};
+
+            blaze::StaticVector< T, N > xl {};
+            blaze::StaticVector< T, N > fl {};
+            blaze::StaticVector< T, N > fplus {};
+            blaze::StaticVector< T, N > fminus {};
+
+            for (size_t l = 0; l < count; ++l) {
+                active[l] = true;
+                for (size_t i = 0; i < N; ++i) x[i][l] = static_cast< T >(guesses[first + l][i]);
+            }
+
+            for (int iter = 0;; ++iter) {
+                // Evaluate the functions and check for convergence, one problem at a time.
+                bool any = false;
+                for (size_t l = 0; l < count; ++l) {
+                    if (!active[l]) continue;
+                    for (size_t i = 0; i < N; ++i) xl[i] = x[i][l];
+                    system(std::span< const T >(xl.data(), N), params[first + l], std::span< T >(fl.data(), N));
+
+                    T sum {};
+                    for (size_t i = 0; i < N; ++i) sum += fl[i] * fl[i];
+                    const T residual = sqrt(sum);
+
+                    if (!isfinite(residual) || residual < eps || iter >= maxiter) {
+                        active[l]         = false;
+                        auto& result      = results[first + l];
+                        result.root       = xl;
+                        result.residual   = residual;
+                        result.iterations = iter;
+                        result.converged  = residual < eps;
+                        continue;
+                    }
+                    any = true;
+                    for (size_t i = 0; i < N; ++i) f[i][l] = fl[i];
+
+                    // Compute the Jacobian of the problem.
+                    blaze::StaticMatrix< T, N, N > Jl {};
+                    auto bound = [&](std::span< const T > xs, std::span< T > fs) { system(xs, params[first + l], fs); };
+                    deriv::detail::jacobianByColumns(bound, xl, fplus, fminus, Jl);
+                    for (size_t i = 0; i < N; ++i)
+                        for (size_t j = 0; j < N; ++j) J[i][j][l] = Jl(i, j);
+                }
+                if (!any) break;
+
+                // Mask out the problems that are no longer iterated (including unused lanes).
+                for (size_t l = 0; l < L; ++l) {
+                    if (active[l]) continue;
+                    for (size_t i = 0; i < N; ++i) {
+                        f[i][l] = T {};
+                        for (size_t j = 0; j < N; ++j) J[i][j][l] = (i == j ? T { 1 } : T {});
+                    }
+                }
+
+                // Solve J * dx = f for all problems, using Gaussian elimination with partial pivoting.
+                for (size_t k = 0; k < N; ++k) {
+                    for (size_t l = 0; l < L; ++l) {
+                        size_t pivot = k;
+                        for (size_t i = k + 1; i < N; ++i)
+                            if (abs(J[i][k][l]) > abs(J[pivot][k][l])) pivot = i;
+                        if (pivot == k) continue;
+                        for (size_t j = k; j < N; ++j) swap(J[k][j][l], J[pivot][j][l]);
+                        swap(f[k][l], f[pivot][l]);
+                    }
+                    for (size_t i = k + 1; i < N; ++i) {
+                        T factor[L];
+                        for (size_t l = 0; l < L; ++l) factor[l] = J[i][k][l] / J[k][k][l];
+                        for (size_t j = k + 1; j < N; ++j)
+                            for (size_t l = 0; l < L; ++l) J[i][j][l] -= factor[l] * J[k][j][l];
+                        for (size_t l = 0; l < L; ++l) f[i][l] -= factor[l] * f[k][l];
+                    }
+                }
+                for (size_t i = N; i-- > 0;) {
+                    for (size_t j = i + 1; j < N; ++j)
+                        for (size_t l = 0; l < L; ++l) f[i][l] -= J[i][j][l] * f[j][l];
+                    for (size_t l = 0; l < L; ++l) f[i][l] /= J[i][i][l];
+                }
+
+                // Update the iterates (x_new = x_old - dx); the steps of masked problems are zero.
+                for (size_t i = 0; i < N; ++i)
+                    for (size_t l = 0; l < L; ++l) x[i][l] -= f[i][l];
+            }
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Solves a batch of independent systems of N equations, which share the same equations but differ in their parameters.
+     *
+     * @details The problems are solved in blocks of `detail::BatchLanes` problems, with the state of each block kept in
+     *          structure-of-arrays layout, such that the linear algebra is vectorized across problems. If a thread
+     *          pool is given, the blocks are distributed over its threads.
+     *
+     *          Contrary to multisolve, a problem for which a non-finite result is encountered does not produce an
+     *          error; its result has a non-finite residual and the `converged` flag set to false. The other problems
+     *          of the batch are unaffected.
+     *
+     * @tparam SOLVER_T Template class of the solver; currently, only MultiNewton is supported.
+     * @tparam N The number of unknowns (and equations) of each system.
+     * @tparam FN_T The type of the system, invocable as `system(std::span<const T> x, const PARAMS& p, std::span<T> f)`.
+     * @tparam PARAMS_T Random access range of the parameters of the problems.
+     * @tparam GUESSES_T Random access range of the initial guesses, each of which has N elements.
+     * @tparam RESULTS_T Random access range of `MultirootResult<T, blaze::StaticVector<T, N>>` receiving the results.
+     * @tparam EPS_T Floating point type for the convergence tolerance.
+     * @tparam ITER_T Integral type for the maximum number of iterations.
+     * @param system The system of equations.
+     * @param params The parameters of each of the problems.
+     * @param guesses The initial guesses of each of the problems.
+     * @param results The results of each of the problems.
+     * @param eps Convergence tolerance.
+     * @param maxiter Maximum number of iterations.
+     * @param pool Optional thread pool used to solve the blocks in parallel.
+     * @return The number of problems that converged.
+     * @throws NumerixxError If the sizes of the ranges do not match.
+     */
+    template< template< typename, typename > class SOLVER_T,
+              size_t N,
+              typename FN_T,
+              std::ranges::random_access_range PARAMS_T,
+              std::ranges::random_access_range GUESSES_T,
+              std::ranges::random_access_range RESULTS_T,
+              IsFloat                          EPS_T  = detail::BatchValue_t< GUESSES_T >,
+              std::integral                    ITER_T = int >
+    requires detail::IsBatchSolver< SOLVER_T > &&
+             std::invocable< const FN_T&,
+                             std::span< const detail::BatchValue_t< GUESSES_T > >,
+                             std::ranges::range_reference_t< const PARAMS_T >,
+                             std::span< detail::BatchValue_t< GUESSES_T > > >
+    size_t multisolve_batch(const FN_T&      system,
+                            const PARAMS_T&  params,
+                            const GUESSES_T& guesses,
+                            RESULTS_T&&      results,
+                            EPS_T            eps     = epsilon< detail::BatchValue_t< GUESSES_T > >(),
+                            ITER_T           maxiter = iterations< detail::BatchValue_t< GUESSES_T > >(),
+                            ThreadPool*      pool    = nullptr)
+    {
+        using T = detail::BatchValue_t< GUESSES_T >;
+        static_assert(std::is_same_v< std::ranges::range_value_t< RESULTS_T >, MultirootResult< T, blaze::StaticVector< T, N > > >,
+                      "The results must be of type MultirootResult<T, blaze::StaticVector<T, N>>.");
+
+        const size_t size = std::ranges::size(params);
+        if (std::ranges::size(guesses) != size || std::ranges::size(results) != size)
+            throw NumerixxError("The number of parameters, guesses and results must be equal.", NumerixxErrorType::MultiRoots);
+        for (const auto& guess : guesses)
+            if (std::ranges::size(guess) != N)
+                throw NumerixxError("The size of an initial guess does not match the size of the system.", NumerixxErrorType::MultiRoots);
+
+        const size_t blocks     = (size + detail::BatchLanes - 1) / detail::BatchLanes;
+        auto         solveBlock = [&](size_t block) {
+            const size_t first = block * detail::BatchLanes;
+            detail::multisolve_block< N >(system,
+                                          params,
+                                          guesses,
+                                          results,
+                                          first,
+                                          std::min(detail::BatchLanes, size - first),
+                                          static_cast< T >(eps),
+                                          static_cast< int >(maxiter));
+        };
+
+        if (pool)
+            pool->parallel_for(blocks, solveBlock);
+        else
+            for (size_t block = 0; block < blocks; ++block) solveBlock(block);
+
+        return static_cast< size_t >(std::ranges::count_if(results, [](const auto& result) { return result.converged; }));
+    }
+
+}    // namespace nxx::multiroots
+
+#endif    // NUMERIXX_MULTIROOTSBATCH_HPP
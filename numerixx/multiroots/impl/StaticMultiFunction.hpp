@@ -0,0 +1,79 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2024 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file StaticMultiFunction.hpp
+ * @brief This file contains the declaration of the StaticMultiFunction class.
+ *
+ * The StaticMultiFunction class attaches a size, known at compile time, to a MultiFunctionArray or a
+ * MultiFunctionSystem. The multiroot solvers use the size to keep the root estimate, the function values
+ * and the Jacobian in fixed-size (stack allocated) Blaze vectors and matrices, which removes all heap
+ * allocations from the iterations of small systems.
+ */
+
+#ifndef NUMERIXX_STATICMULTIFUNCTION_HPP
+#define NUMERIXX_STATICMULTIFUNCTION_HPP
+
+#include <cstddef>
+#include <utility>
+
+namespace nxx::multiroots
+{
+    /**
+     * @class StaticMultiFunction
+     * @brief Template class for a system of equations with a number of unknowns known at compile time.
+     *
+     * @details The class derives from the wrapped function type, so it can be evaluated in exactly the same
+     *          ways. The only addition is the `extent` member, which is picked up by the multiroot solvers.
+     *          Normally, objects of this type are not created directly, but by calling
+     *          `multisolve<SOLVER, N>(functions, guess)`.
+     *
+     * @tparam FUNCTION_T The type of the functions, i.e. a MultiFunctionArray or a MultiFunctionSystem.
+     * @tparam N The number of unknowns (and equations) of the system.
+     */
+    template< typename FUNCTION_T, std::size_t N >
+    requires(N > 0)
+    class StaticMultiFunction : public FUNCTION_T
+    {
+    public:
+        static constexpr std::size_t extent = N;    ///< The number of unknowns of the system.
+
+        /**
+         * @brief Constructs a StaticMultiFunction object from a function array or system.
+         * @param system The functions of the system.
+         */
+        explicit StaticMultiFunction(FUNCTION_T system)
+            : FUNCTION_T { std::move(system) }
+        {}
+    };
+
+}    // namespace nxx::multiroots
+
+#endif    // NUMERIXX_STATICMULTIFUNCTION_HPP
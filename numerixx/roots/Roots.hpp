@@ -51,6 +51,7 @@ namespace nxx::roots
 
 
 #include "impl/RootBracketing.hpp"
+#include "impl/RootFixedPoint.hpp"
 #include "impl/RootPolishing.hpp"
 #include "impl/RootSearching.hpp"
 
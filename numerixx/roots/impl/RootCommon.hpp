@@ -252,6 +252,39 @@ namespace nxx::roots
         };
     } // namespace impl
 
+    // ========================================================================
+    // TRAITS CLASSES FOR FIXED-POINT ITERATION
+    // ========================================================================
+
+    template<IsFloatInvocable FN, IsFloat ARG_T>
+    class FixedPoint;
+
+    template<IsFloatInvocable FN, IsFloat ARG_T>
+    class Aitken;
+
+    namespace detail
+    {
+        /*
+         * Forward declaration of the FixedPointTraits class.
+         */
+        template<typename... ARGS>
+        struct FixedPointTraits;
+
+        template<typename FN, typename T>
+        struct FixedPointTraits< FixedPoint< FN, T > >
+        {
+            using FUNCTION_T = FN;
+            using RETURN_T = std::invoke_result_t< FN, T >;
+        };
+
+        template<typename FN, typename T>
+        struct FixedPointTraits< Aitken< FN, T > >
+        {
+            using FUNCTION_T = FN;
+            using RETURN_T = std::invoke_result_t< FN, T >;
+        };
+    } // namespace detail
+
     template<IsFloatInvocable FN, IsFloat ARG_T>
     class BracketSearchUp;
 
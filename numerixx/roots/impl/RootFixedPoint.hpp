@@ -0,0 +1,302 @@
+/*
+    888b      88  88        88  88b           d88  88888888888  88888888ba   88  8b        d8  8b        d8
+    8888b     88  88        88  888b         d888  88           88      "8b  88   Y8,    ,8P    Y8,    ,8P
+    88 `8b    88  88        88  88`8b       d8'88  88           88      ,8P  88    `8b  d8'      `8b  d8'
+    88  `8b   88  88        88  88 `8b     d8' 88  88aaaaa      88aaaaaa8P'  88      Y88P          Y88P
+    88   `8b  88  88        88  88  `8b   d8'  88  88"""""      88""""88'    88      d88b          d88b
+    88    `8b 88  88        88  88   `8b d8'   88  88           88    `8b    88    ,8P  Y8,      ,8P  Y8,
+    88     `8888  Y8a.    .a8P  88    `888'    88  88           88     `8b   88   d8'    `8b    d8'    `8b
+    88      `888   `"Y8888Y"'   88     `8'     88  88888888888  88      `8b  88  8P        Y8  8P        Y8
+
+    Copyright © 2022 Kenneth Troldal Balslev
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the “Software”), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is furnished
+    to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+    INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+    PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+    HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+    OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef NUMERIXX_ROOTFIXEDPOINT_HPP
+#define NUMERIXX_ROOTFIXEDPOINT_HPP
+
+// ===== Numerixx Includes
+#include "RootCommon.hpp"
+#include <Constants.hpp>
+
+// ===== External Includes
+#include <tl/expected.hpp>
+
+// ===== Standard Library Includes
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace nxx::roots
+{
+    // =================================================================================================================
+    //
+    //  88888888888  88                                 88  88888888ba                  88
+    //  88           ""                                 88  88      "8b                 ""                ,d
+    //  88                                              88  88      ,8P                                   88
+    //  88aaaaa      88  8b,     ,d8   ,adPPYba,   ,adPPYb,88  88aaaaaa8P'  ,adPPYba,   88  8b,dPPYba,  MM88MMM
+    //  88"""""      88   `Y8, ,8P'   a8P_____88  a8"    `Y88  88""""""'   a8"     "8a  88  88P'   `"8a   88
+    //  88           88     )888(     8PP"""""""  8b       88  88          8b       d8  88  88       88   88
+    //  88           88   ,d8" "8b,   "8b,   ,aa  "8a,   ,d88  88          "8a,   ,a8"  88  88       88   88,
+    //  88           88  8P'     `Y8   `"Ybbd8"'   `"8bbdP"Y8  88           `"YbbdP"'   88  88       88   "Y888
+    //
+    // =================================================================================================================
+
+    /*
+     * Private implementation details.
+     */
+    namespace detail
+    {
+        /**
+         * @brief Provides a base class template for fixed-point solvers, i.e. solvers for problems of the form x = g(x).
+         *
+         * The FixedPointBase class template stores the map g and the current estimate of the fixed point, along with
+         * the length of the latest step, which is used for the convergence check. No derivatives are required.
+         *
+         * @tparam SUBCLASS The subclass inheriting from FixedPointBase.
+         * @tparam FUNCTION_T The type of the map g.
+         * @tparam ARG_T The type of the argument to the map.
+         */
+        template< typename SUBCLASS, typename FUNCTION_T, typename ARG_T >
+        requires std::same_as< typename FixedPointTraits< SUBCLASS >::FUNCTION_T, FUNCTION_T > && IsFloatInvocable< FUNCTION_T > &&
+                 IsFloat< ARG_T >
+        class FixedPointBase
+        {
+            friend SUBCLASS;
+
+        public:
+            static constexpr bool IsFixedPointSolver = true; /**< Flag indicating the class is a fixed-point solver. */
+
+            using RESULT_T = std::common_type_t< std::invoke_result_t< FUNCTION_T, ARG_T >, ARG_T >; /**< Type of the result. */
+
+        protected:
+            ~FixedPointBase() = default; /**< Protected destructor to prevent direct instantiation. */
+
+        private:
+            FUNCTION_T m_func {}; /**< The map g, for which a fixed point is sought. */
+            RESULT_T   m_guess;   /**< The current estimate of the fixed point. */
+            RESULT_T   m_step { std::numeric_limits< RESULT_T >::infinity() }; /**< The length of the latest step. */
+
+        public:
+            /**
+             * @brief Constructs the FixedPointBase with a map and an initial guess.
+             * @param function The map g, for which a fixed point is sought.
+             * @param guess Initial guess for the fixed point.
+             */
+            FixedPointBase(FUNCTION_T function, ARG_T guess)
+                : m_func { function },
+                  m_guess { guess }
+            {}
+
+            FixedPointBase(const FixedPointBase& other)                = default; /**< Default copy constructor. */
+            FixedPointBase(FixedPointBase&& other) noexcept            = default; /**< Default move constructor. */
+            FixedPointBase& operator=(const FixedPointBase& other)     = default; /**< Default copy assignment operator. */
+            FixedPointBase& operator=(FixedPointBase&& other) noexcept = default; /**< Default move assignment operator. */
+
+            /**
+             * @brief Evaluates the map with the given value.
+             * @param value The value to evaluate the map at.
+             * @return The result of the map evaluation.
+             */
+            RESULT_T evaluate(RESULT_T value) { return std::invoke(m_func, value); }
+
+            /**
+             * @brief Returns the current estimate of the fixed point.
+             * @return The current estimate.
+             */
+            RESULT_T current() const { return m_guess; }
+
+            /**
+             * @brief Returns the length of the latest step, |x_{k+1} - x_k|; infinity before the first iteration.
+             * @return The length of the latest step.
+             */
+            RESULT_T step() const { return m_step; }
+
+            /**
+             * @brief Performs one iteration, using the subclass's implementation.
+             */
+            void iterate() { std::invoke(static_cast< SUBCLASS& >(*this)); }
+        };
+    }    // namespace detail
+
+    /**
+     * @brief Defines the FixedPoint class for the plain fixed-point iteration, x_{k+1} = g(x_k).
+     *
+     * The iteration converges linearly if |g'| < 1 near the fixed point, with a rate given by |g'|. Hence, it may
+     * be slow, but each iteration requires a single evaluation of g.
+     *
+     * @tparam FN The type of the map g.
+     * @tparam ARG_T The type of the argument to the map, defaults to double.
+     */
+    template< IsFloatInvocable FN, IsFloat ARG_T = double >
+    class FixedPoint final : public detail::FixedPointBase< FixedPoint< FN, ARG_T >, FN, ARG_T >
+    {
+        using BASE = detail::FixedPointBase< FixedPoint< FN, ARG_T >, FN, ARG_T >; /**< Base class alias for readability. */
+
+    public:
+        using BASE::BASE; /**< Inherits constructors from FixedPointBase. */
+
+        /**
+         * @brief Performs a single iteration, x <- g(x).
+         */
+        void operator()()
+        {
+            using std::abs;
+            const auto next = BASE::evaluate(BASE::m_guess);
+            BASE::m_step    = abs(next - BASE::m_guess);
+            BASE::m_guess   = next;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for the FixedPoint class.
+     */
+    template< typename FN, typename ARG_T >
+    requires IsFloatInvocable< FN > && IsFloat< ARG_T >
+    FixedPoint(FN, ARG_T) -> FixedPoint< FN, ARG_T >;
+
+    /**
+     * @brief Defines the Aitken class for the fixed-point iteration accelerated by Aitken's delta-squared process.
+     *
+     * Each iteration computes two plain iterates, x1 = g(x0) and x2 = g(x1), and restarts from the extrapolated
+     * value x0 - (x1 - x0)^2 / (x2 - 2*x1 + x0) (Steffensen's method for fixed points). The convergence is quadratic
+     * near a simple fixed point, even if the plain iteration diverges, at the cost of two evaluations of g per
+     * iteration. If the denominator vanishes, e.g. because the iteration has converged, x2 is used instead.
+     *
+     * @tparam FN The type of the map g.
+     * @tparam ARG_T The type of the argument to the map, defaults to double.
+     */
+    template< IsFloatInvocable FN, IsFloat ARG_T = double >
+    class Aitken final : public detail::FixedPointBase< Aitken< FN, ARG_T >, FN, ARG_T >
+    {
+        using BASE = detail::FixedPointBase< Aitken< FN, ARG_T >, FN, ARG_T >; /**< Base class alias for readability. */
+
+    public:
+        using BASE::BASE; /**< Inherits constructors from FixedPointBase. */
+
+        /**
+         * @brief Performs a single iteration of Steffensen's method for fixed points.
+         */
+        void operator()()
+        {
+            using std::abs;
+            using std::isfinite;
+
+            const auto x0          = BASE::m_guess;
+            const auto x1          = BASE::evaluate(x0);
+            const auto x2          = BASE::evaluate(x1);
+            const auto denominator = x2 - 2 * x1 + x0;
+
+            auto next = x2;
+            if (denominator != 0) {
+                const auto extrapolated = x0 - (x1 - x0) * (x1 - x0) / denominator;
+                if (isfinite(extrapolated)) next = extrapolated;
+            }
+
+            BASE::m_step  = abs(next - x0);
+            BASE::m_guess = next;
+        }
+    };
+
+    /**
+     * @brief Deduction guide for the Aitken class.
+     */
+    template< typename FN, typename ARG_T >
+    requires IsFloatInvocable< FN > && IsFloat< ARG_T >
+    Aitken(FN, ARG_T) -> Aitken< FN, ARG_T >;
+
+    namespace detail
+    {
+        /**
+         * @brief Implements the iteration loop for fixed-point solvers.
+         *
+         * The solver is iterated until the length of a step is less than eps, in which case the latest estimate is
+         * returned, or until the maximum number of iterations is exceeded, or a non-finite estimate is encountered,
+         * in which case an error is returned.
+         *
+         * @tparam SOLVER The type of the solver. Must be a fixed-point solver.
+         */
+        template< typename SOLVER >
+        requires SOLVER::IsFixedPointSolver
+        auto fpsolve_impl(SOLVER solver, IsFloat auto eps, std::integral auto maxiter)
+        {
+            using ERROR_T  = detail::RootErrorImpl< typename SOLVER::RESULT_T >; /**< Type for error handling. */
+            using RETURN_T = tl::expected< typename SOLVER::RESULT_T, ERROR_T >; /**< Type for the function return value. */
+
+            using std::isfinite;
+            RETURN_T result = solver.current();
+
+            int iter = 0;
+            while (true) {
+                // Check for exceeding the maximum number of iterations.
+                if (iter >= maxiter) {
+                    result = tl::make_unexpected(
+                        ERROR_T("Maximum number of iterations exceeded!", RootErrorType::MaxIterationsExceeded, solver.current(), iter));
+                    break;
+                }
+
+                // Perform one iteration.
+                ++iter;
+                solver.iterate();
+
+                // Check for non-finite results.
+                if (!isfinite(solver.current())) {
+                    result = tl::make_unexpected(ERROR_T("Non-finite result!", RootErrorType::NumericalError, solver.current(), iter));
+                    break;
+                }
+
+                // Check for convergence.
+                if (solver.step() < eps) {
+                    result = solver.current();
+                    break;
+                }
+            }
+
+            return result;
+        }
+    }    // namespace detail
+
+    /**
+     * @brief Finds a fixed point x = g(x) of a scalar map, using a fixed-point solver.
+     *
+     * @tparam SOLVER_T The template class of the solver to be used, i.e. FixedPoint or Aitken.
+     * @tparam FN_T The type of the map g.
+     * @tparam ARG_T The type of the initial guess.
+     * @tparam EPS_T The type of the tolerance, defaulted based on ARG_T.
+     * @tparam ITER_T The type of the maximum iterations count, defaulted to int.
+     *
+     * @param function The map g, for which a fixed point is sought.
+     * @param guess The initial guess.
+     * @param eps The tolerance for the length of a step.
+     * @param maxiter The maximum number of iterations allowed.
+     * @return A tl::expected with the fixed point, or an error.
+     */
+    template< template< typename, typename > class SOLVER_T,
+              IsFloatInvocable FN_T,
+              IsFloat          ARG_T,
+              IsFloat          EPS_T  = ARG_T,
+              std::integral    ITER_T = int >
+    auto fpsolve(FN_T function, ARG_T guess, EPS_T eps = epsilon< ARG_T >(), ITER_T maxiter = iterations< ARG_T >())
+    {
+        return detail::fpsolve_impl(SOLVER_T< FN_T, ARG_T >(function, guess), eps, maxiter);
+    }
+}    // namespace nxx::roots
+
+#endif    // NUMERIXX_ROOTFIXEDPOINT_HPP
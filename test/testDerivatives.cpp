@@ -3,6 +3,7 @@
 //
 
 #include <Deriv.hpp>
+#include <Multiroots.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -10,6 +11,10 @@
 #include <cmath>
 #include <functional>
 #include <numbers>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 TEST_CASE("nxx::deriv - Numerical Derivatives Test", "[derivatives]")
@@ -152,4 +157,176 @@ TEST_CASE("nxx::deriv - Numerical Derivatives Test", "[derivatives]")
 
     SECTION("Order2Backward4Point")
     { testDerivativeMethod(Order2Backward4Point {}, functions, second_derivatives, evals, 1E-3); }
-}
\ No newline at end of file
+}
+
+TEST_CASE("nxx::deriv - Directional Derivatives Test", "[derivatives]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    auto f1 = [](std::span< double > x) { return x[0] * x[0] + std::sin(x[1]); };
+    auto f2 = [](std::span< double > x) { return std::exp(x[0]) * x[1] - 3 * x[1] * x[1]; };
+
+    MultiFunctionArray functions { f1, f2 };
+
+    const std::vector< double > x { 0.5, 1.5 };
+    const std::vector< double > v { -2.0, 0.25 };
+
+    SECTION("Jacobian-vector product")
+    {
+        auto J  = jacobian(functions, x);
+        auto Jv = jvp(functions, x, v);
+
+        for (size_t i = 0; i < functions.size(); ++i) {
+            const double expected = J(i, 0) * v[0] + J(i, 1) * v[1];
+            REQUIRE_THAT(Jv[i], Catch::Matchers::WithinAbs(expected, 1E-6));
+        }
+
+        auto fx = functions.eval< blaze::DynamicVector >(x);
+        REQUIRE_THAT(jvp(functions, x, v, fx)[0], Catch::Matchers::WithinAbs(Jv[0], 1E-12));
+        REQUIRE(jvp(functions, x, std::vector< double > { 0.0, 0.0 })[1] == 0.0);
+    }
+
+    SECTION("Gradient-vector product")
+    {
+        const double expected = (2 * x[0]) * v[0] + std::cos(x[1]) * v[1];
+        REQUIRE_THAT(gradient_dot(f1, x, v), Catch::Matchers::WithinAbs(expected, 1E-6));
+        REQUIRE_THAT(gradient_dot(functions[0], x, v), Catch::Matchers::WithinAbs(expected, 1E-6));
+    }
+}
+
+TEST_CASE("nxx::deriv - Automatic Differentiation Test", "[derivatives]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    auto f1 = [](auto x) { return 3 * x[0] - cos(x[1] * x[2]) - 0.5; };
+    auto f2 = [](auto x) { return x[0] * x[0] - 81 * pow(x[1] + 0.1, 2.0) + sin(x[2]) + 1.06; };
+    auto f3 = [](auto x) { return exp(-x[0] * x[1]) + 20 * x[2] + sqrt(x[0] + 1.0); };
+
+    const std::vector< double > x { 0.3, 0.2, 0.7 };
+
+    SECTION("Dual numbers")
+    {
+        auto d = Dual< double, 2 >::variable(2.0, 1);
+        auto r = 1.0 / d + d * d - log(d);
+
+        REQUIRE_THAT(r.value(), Catch::Matchers::WithinAbs(0.5 + 4.0 - std::log(2.0), 1E-15));
+        REQUIRE_THAT(r.tangent(1), Catch::Matchers::WithinAbs(-0.25 + 4.0 - 0.5, 1E-15));
+        REQUIRE(r.tangent(0) == 0.0);
+
+        // A negative base with an integer exponent is well-defined, as long as the exponent is not differentiated.
+        auto p = pow(Dual< double, 2 >::variable(-2.0, 0), Dual< double, 2 >(3.0));
+        REQUIRE(p.value() == -8.0);
+        REQUIRE(p.tangent(0) == 12.0);
+        REQUIRE(p.tangent(1) == 0.0);
+
+        auto q = pow(Dual< double, 2 >::variable(2.0, 0), Dual< double, 2 >::variable(3.0, 1));
+        REQUIRE(q.value() == 8.0);
+        REQUIRE(q.tangent(0) == 12.0);
+        REQUIRE_THAT(q.tangent(1), Catch::Matchers::WithinAbs(8.0 * std::log(2.0), 1E-14));
+    }
+
+    SECTION("Jacobian")
+    {
+        MultiFunctionArray functions { [&](std::span< double > s) { return f1(s); },
+                                       [&](std::span< double > s) { return f2(s); },
+                                       [&](std::span< double > s) { return f3(s); } };
+
+        auto J      = jacobian< AutoDiff >(std::tuple { f1, f2, f3 }, x);
+        auto Jlanes = jacobian< AutoDiffLanes< 2 > >(std::tuple { f1, f2, f3 }, x);
+        auto Jfd    = jacobian(functions, x);
+
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j) {
+                REQUIRE_THAT(J(i, j), Catch::Matchers::WithinAbs(Jfd(i, j), 1E-6));
+                REQUIRE(J(i, j) == Jlanes(i, j));
+            }
+    }
+}
+
+TEST_CASE("nxx::deriv - Reverse Mode Automatic Differentiation Test", "[derivatives]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    SECTION("Gradient of a high-dimensional function")
+    {
+        // Extended Rosenbrock function
+        auto rosenbrock = [](auto x) {
+            using VAL_T = std::remove_cvref_t< decltype(x[0]) >;
+            VAL_T result {};
+            for (size_t i = 0; i + 1 < x.size(); ++i) result += 100 * pow(x[i + 1] - x[i] * x[i], 2.0) + pow(1 - x[i], 2.0);
+            return result;
+        };
+
+        std::vector< double > x(500);
+        for (size_t i = 0; i < x.size(); ++i) x[i] = 0.5 + 0.001 * static_cast< double >(i);
+
+        Tape< double > tape;
+        auto           grad = gradient< ReverseAD >(rosenbrock, x, tape);
+
+        REQUIRE(grad.size() == x.size());
+        for (size_t i = 0; i < x.size(); ++i) {
+            double expected = 0.0;
+            if (i + 1 < x.size()) expected += -400 * x[i] * (x[i + 1] - x[i] * x[i]) - 2 * (1 - x[i]);
+            if (i > 0) expected += 200 * (x[i] - x[i - 1] * x[i - 1]);
+            REQUIRE_THAT(grad[i], Catch::Matchers::WithinRel(expected, 1E-12));
+        }
+
+        // The tape is rewound after use, but keeps its memory for subsequent calls.
+        REQUIRE(tape.size() == 0);
+        const auto capacity = tape.capacity();
+        gradient< ReverseAD >(rosenbrock, x, tape);
+        REQUIRE(tape.capacity() == capacity);
+
+        // The overload taking a buffer gives the same gradient.
+        std::vector< double > buffer(x.size());
+        gradient< ReverseAD >(rosenbrock, x, std::span< double >(buffer), tape);
+        for (size_t i = 0; i < x.size(); ++i) REQUIRE(buffer[i] == grad[i]);
+        REQUIRE(tape.size() == 0);
+        REQUIRE(tape.capacity() == capacity);
+
+        // The tape is also rewound if the function throws.
+        auto throwing = [&](auto args) {
+            rosenbrock(args);
+            throw std::runtime_error("Failed");
+            return args[0];
+        };
+        REQUIRE_THROWS_AS(gradient< ReverseAD >(throwing, x, std::span< double >(buffer), tape), std::runtime_error);
+        REQUIRE(tape.size() == 0);
+        REQUIRE_THROWS_AS(gradient< ReverseAD >(throwing, x), std::runtime_error);
+        REQUIRE(defaultTape< double >().size() == 0);
+    }
+
+    SECTION("Tape checkpoints")
+    {
+        Tape< double > tape;
+        auto           a = tape.variable(3.0);
+        auto           b = tape.variable(4.0);
+
+        const auto checkpoint = tape.checkpoint();
+        auto       r          = sqrt(a * a + b * b);
+        tape.backward(r);
+        REQUIRE_THAT(tape.adjoint(a), Catch::Matchers::WithinAbs(0.6, 1E-15));
+        REQUIRE_THAT(tape.adjoint(b), Catch::Matchers::WithinAbs(0.8, 1E-15));
+
+        tape.rewind(checkpoint);
+        REQUIRE(tape.size() == 2);
+
+        auto s = a * b - 2.0 * a;
+        tape.backward(s);
+        REQUIRE(tape.adjoint(a) == 2.0);
+        REQUIRE(tape.adjoint(b) == 3.0);
+        REQUIRE(nxx::IsFloat< Var< double > >);
+
+        // The exponent partial of pow is not finite at a zero base, and must not poison the other adjoints.
+        tape.rewind(checkpoint);
+        auto z = tape.variable(0.0);
+        auto t = pow(z, b) + 2.0 * a;
+        tape.backward(t);
+        REQUIRE(tape.adjoint(a) == 2.0);
+        REQUIRE(tape.adjoint(b) == 0.0);
+        REQUIRE(tape.adjoint(z) == 0.0);
+    }
+}
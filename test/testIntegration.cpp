@@ -0,0 +1,331 @@
+// ================================================================================================
+// Catch2 test file for the numerical integration routines.
+// ================================================================================================
+
+#include <Integ.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+TEST_CASE("nxx::integrate - Simpson Test", "[integrate]")
+{
+    using namespace nxx::integrate;
+
+    int  evaluations = 0;
+    auto f           = [&evaluations](double x) {
+        ++evaluations;
+        return std::exp(x) * std::sin(3 * x);
+    };
+
+    SECTION("Composite Simpson's rule")
+    {
+        // After k iterations, the estimate equals the composite Simpson's rule with 2^k intervals.
+        auto solver = Simpson(f, { 0.0, 2.0 });
+        for (int k = 1; k <= 6; ++k) {
+            solver.iterate();
+
+            const int    n = 1 << k;
+            const double h = 2.0 / n;
+            double       sum = f(0.0) + f(2.0);
+            for (int i = 1; i < n; ++i) sum += f(i * h) * (i % 2 == 0 ? 2 : 4);
+            REQUIRE_THAT(solver.current(), Catch::Matchers::WithinRel(sum * h / 3, 1E-14));
+        }
+
+        // Simpson's rule is exact for cubic polynomials.
+        auto cubic = Simpson([](double x) { return x * x * x - 2 * x + 1; }, { -1.0, 3.0 });
+        cubic.iterate();
+        REQUIRE_THAT(cubic.current(), Catch::Matchers::WithinAbs(16.0, 1E-14));
+    }
+
+    SECTION("Function evaluations")
+    {
+        // Each function value is computed once: 2^k + 1 evaluations after k iterations.
+        evaluations = 0;
+        auto solver = Simpson(f, { 0.0, 2.0 });
+        for (int k = 1; k <= 8; ++k) {
+            solver.iterate();
+            REQUIRE(evaluations == (1 << k) + 1);
+        }
+
+        const double exact = (std::exp(2.0) * (std::sin(6.0) - 3 * std::cos(6.0)) + 3) / 10;
+        auto         result = integrate< Simpson >(f, std::pair { 0.0, 2.0 }, 1E-10);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(exact, 1E-9));
+        REQUIRE_THAT(*integrate< Simpson >([](double x) { return std::sin(x); }, { 0.0, std::numbers::pi }, 1E-12),
+                     Catch::Matchers::WithinAbs(2.0, 1E-11));
+    }
+}
+
+TEST_CASE("nxx::integrate - Romberg Test", "[integrate]")
+{
+    using namespace nxx::integrate;
+
+    int  evaluations = 0;
+    auto f           = [&evaluations](double x) {
+        ++evaluations;
+        return std::exp(x) * std::sin(3 * x);
+    };
+
+    const double exact = (std::exp(2.0) * (std::sin(6.0) - 3 * std::cos(6.0)) + 3) / 10;
+
+    SECTION("Romberg table")
+    {
+        // The second column of the table is Simpson's rule, and column k is exact for polynomials of degree 2k + 1.
+        auto romberg = Romberg(f, { 0.0, 2.0 });
+        auto simpson = Simpson(f, { 0.0, 2.0 });
+        romberg.iterate();
+        simpson.iterate();
+        REQUIRE_THAT(romberg.current(), Catch::Matchers::WithinRel(simpson.current(), 1E-14));
+
+        auto quintic = Romberg([](double x) { return std::pow(x, 5) - x * x; }, { 0.0, 2.0 });
+        quintic.iterate();
+        quintic.iterate();
+        REQUIRE_THAT(quintic.current(), Catch::Matchers::WithinAbs(32.0 / 3 - 8.0 / 3, 1E-13));
+    }
+
+    SECTION("Function evaluations")
+    {
+        evaluations = 0;
+        auto solver = Romberg(f, { 0.0, 2.0 });
+        for (int k = 1; k <= 10; ++k) {
+            solver.iterate();
+            REQUIRE(evaluations == (1 << k) + 1);
+        }
+        REQUIRE_THAT(solver.current(), Catch::Matchers::WithinAbs(exact, 1E-13));
+
+        auto result = integrate< Romberg >(f, std::pair { 0.0, 2.0 }, 1E-12);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(exact, 1E-12));
+    }
+}
+
+TEST_CASE("nxx::integrate - Gauss-Kronrod Test", "[integrate]")
+{
+    using namespace nxx::integrate;
+
+    int  evaluations = 0;
+    auto peak        = [&evaluations](double x) {
+        ++evaluations;
+        return 1.0 / (1E-4 + (x - 0.3) * (x - 0.3));
+    };
+    const double exact = (std::atan(0.7 / 1E-2) + std::atan(0.3 / 1E-2)) / 1E-2;
+
+    SECTION("Single interval")
+    {
+        // The 15-point Kronrod rule is exact for polynomials of degree 22, and the 21-point rule for degree 31.
+        auto poly15 = GaussKronrod([](double x) { return std::pow(x, 22) + x; }, { -1.0, 1.0 });
+        auto poly21 = GaussKronrod21([](double x) { return std::pow(x, 30) + x; }, { -1.0, 1.0 });
+        REQUIRE(std::isinf(poly15.error()));
+        poly15.iterate();
+        poly21.iterate();
+        REQUIRE_THAT(poly15.current(), Catch::Matchers::WithinRel(2.0 / 23, 1E-14));
+        REQUIRE_THAT(poly21.current(), Catch::Matchers::WithinRel(2.0 / 31, 1E-14));
+
+        // For a smooth integrand, a single application of the rule is accurate to machine precision.
+        auto smooth = GaussKronrod([](double x) { return std::exp(x) * std::cos(x); }, { 0.0, 1.0 });
+        smooth.iterate();
+        const double value = (std::exp(1.0) * (std::sin(1.0) + std::cos(1.0)) - 1) / 2;
+        REQUIRE_THAT(smooth.current(), Catch::Matchers::WithinAbs(value, 1E-15));
+        // The error estimate is bounded below by the roundoff level, 50 * epsilon * integral of |f|.
+        REQUIRE(smooth.error() >= 50 * std::numeric_limits< double >::epsilon() * value);
+        REQUIRE(smooth.error() < 1E-13);
+    }
+
+    SECTION("Adaptive refinement")
+    {
+        // The error estimate is conservative.
+        auto solver = GaussKronrod(peak, { 0.0, 1.0 });
+        for (int i = 0; i < 20; ++i) {
+            solver.iterate();
+            REQUIRE(std::abs(solver.current() - exact) <= solver.error());
+        }
+
+        evaluations = 0;
+        auto result = integrate< GaussKronrod >(peak, std::pair { 0.0, 1.0 }, 1E-8);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(exact, 1E-8));
+        const int adaptive = evaluations;
+
+        evaluations = 0;
+        REQUIRE_THAT(*integrate< GaussKronrod21 >(peak, std::pair { 0.0, 1.0 }, 1E-8), Catch::Matchers::WithinAbs(exact, 1E-8));
+        REQUIRE(evaluations < 1000);
+
+        evaluations = 0;
+        REQUIRE_THAT(*integrate< Romberg >(peak, std::pair { 0.0, 1.0 }, 1E-8), Catch::Matchers::WithinAbs(exact, 1E-7));
+        REQUIRE(adaptive * 10 < evaluations);
+    }
+
+    SECTION("Localized integrand")
+    {
+        // A narrow bump, which the uniform refinement of Simpson's rule misses entirely at the first levels.
+        auto         bump  = [](double x) { return std::exp(-1E4 * (x - 0.6) * (x - 0.6)); };
+        const double value = std::sqrt(std::numbers::pi) / 100 * (std::erf(40.0) + std::erf(60.0)) / 2;
+        REQUIRE_THAT(*integrate< GaussKronrod >(bump, { 0.0, 1.0 }, 1E-12), Catch::Matchers::WithinAbs(value, 1E-12));
+        REQUIRE_THAT(*integrate< GaussKronrod21 >(bump, { 0.0, 1.0 }, 1E-12), Catch::Matchers::WithinAbs(value, 1E-12));
+    }
+}
+
+TEST_CASE("nxx::integrate - Gauss-Legendre Test", "[integrate]")
+{
+    using namespace nxx::integrate;
+
+    SECTION("Nodes and weights")
+    {
+        // Compare with the tabulated 5-point rule, and check that the weights of each rule sum to 2.
+        static_assert(GaussLegendre< 5 >::Nodes.size() == 3);
+        REQUIRE_THAT(double(GaussLegendre< 5 >::Nodes[0]), Catch::Matchers::WithinAbs(0.9061798459386640, 1E-15));
+        REQUIRE_THAT(double(GaussLegendre< 5 >::Nodes[1]), Catch::Matchers::WithinAbs(0.5384693101056831, 1E-15));
+        REQUIRE(GaussLegendre< 5 >::Nodes[2] == 0.0L);
+        REQUIRE_THAT(double(GaussLegendre< 5 >::Weights[0]), Catch::Matchers::WithinAbs(0.2369268850561891, 1E-15));
+        REQUIRE_THAT(double(GaussLegendre< 5 >::Weights[2]), Catch::Matchers::WithinAbs(0.5688888888888889, 1E-15));
+
+        auto sumOfWeights = []< size_t N >(GaussLegendre< N >) {
+            long double sum = 0;
+            for (size_t i = 0; i < N / 2; ++i) sum += 2 * GaussLegendre< N >::Weights[i];
+            if (N % 2 == 1) sum += GaussLegendre< N >::Weights[N / 2];
+            return double(sum);
+        };
+        REQUIRE_THAT(sumOfWeights(GaussLegendre< 1 >{}), Catch::Matchers::WithinAbs(2.0, 1E-15));
+        REQUIRE_THAT(sumOfWeights(GaussLegendre< 8 >{}), Catch::Matchers::WithinAbs(2.0, 1E-15));
+        REQUIRE_THAT(sumOfWeights(GaussLegendre< 20 >{}), Catch::Matchers::WithinAbs(2.0, 1E-15));
+    }
+
+    SECTION("Integration")
+    {
+        int  evaluations = 0;
+        auto f           = [&evaluations](double x) {
+            ++evaluations;
+            return std::exp(x) * std::sin(3 * x);
+        };
+        const double exact = (std::exp(2.0) * (std::sin(6.0) - 3 * std::cos(6.0)) + 3) / 10;
+
+        // The N-point rule is exact for polynomials of degree 2N - 1, and costs N evaluations.
+        REQUIRE_THAT(GaussLegendre< 6 >{}([](double x) { return std::pow(x, 11) + std::pow(x, 10); }, 0.0, 2.0),
+                     Catch::Matchers::WithinRel(2048.0 / 6 + 2048.0 / 11, 1E-14));
+        REQUIRE_THAT(GaussLegendre< 20 >{}(f, 0.0, 2.0), Catch::Matchers::WithinAbs(exact, 1E-14));
+        REQUIRE(evaluations == 20);
+
+        auto result = integrate< GaussLegendre< 15 > >(f, { 0.0, 2.0 });
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(exact, 1E-13));
+        REQUIRE_THROWS(integrate< GaussLegendre< 15 > >(f, std::pair { 2.0, 0.0 }));
+        REQUIRE_THAT(integralOf< GaussLegendre< 15 > >(f)({ 0.0, 2.0 }), Catch::Matchers::WithinAbs(exact, 1E-13));
+
+        // The middle node of a rule with an odd number of points is at the pole.
+        REQUIRE_FALSE(integrate< GaussLegendre< 5 > >([](double x) { return 1.0 / x; }, { -1.0, 1.0 }).has_value());
+    }
+}
+
+TEST_CASE("nxx::integrate - TanhSinh Test", "[integrate]")
+{
+    using namespace nxx::integrate;
+
+    SECTION("Endpoint singularities")
+    {
+        int  evaluations = 0;
+        bool endpoints   = false;
+        auto f           = [&](double x) {
+            ++evaluations;
+            if (x == 0.0 || x == 1.0) endpoints = true;
+            return 1.0 / std::sqrt(x);
+        };
+
+        auto result = integrate< TanhSinh >(f, { 0.0, 1.0 }, 1E-12);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(2.0, 1E-12));
+        REQUIRE(evaluations < 200);
+        REQUIRE_FALSE(endpoints);
+
+        // Romberg starts from the trapezoid rule, which evaluates the singular endpoint.
+        REQUIRE_FALSE(integrate< Romberg >(f, { 0.0, 1.0 }, 1E-12).has_value());
+
+        result = integrate< TanhSinh >([](double x) { return std::log(x); }, { 0.0, 1.0 }, 1E-12);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(-1.0, 1E-12));
+
+        result = integrate< TanhSinh >([](double x) { return std::sqrt(1 - x * x); }, { -1.0, 1.0 }, 1E-12);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(std::numbers::pi / 2, 1E-12));
+    }
+
+    SECTION("Smooth integrand")
+    {
+        const double exact  = (std::exp(2.0) * (std::sin(6.0) - 3 * std::cos(6.0)) + 3) / 10;
+        auto         result = integrate< TanhSinh >([](double x) { return std::exp(x) * std::sin(3 * x); }, { 0.0, 2.0 }, 1E-12);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(exact, 1E-11));
+    }
+}
+
+TEST_CASE("nxx::integrate - Parallel Evaluation Test", "[integrate]")
+{
+    using namespace nxx::integrate;
+
+    std::atomic< int > evaluations = 0;
+    auto               f           = [&evaluations](double x) {
+        ++evaluations;
+        return std::exp(x) * std::sin(3 * x);
+    };
+
+    nxx::ThreadPool pool2(2);
+    nxx::ThreadPool pool4(4);
+
+    // The function values are summed in the same order regardless of the number of threads.
+    auto serial = integrate< Romberg >(f, { 0.0, 2.0 }, 1E-12);
+    REQUIRE(serial.has_value());
+    const int serialEvaluations = evaluations;
+
+    evaluations    = 0;
+    auto parallel2 = integrate< Romberg >(f, { 0.0, 2.0 }, 1E-12, 25, &pool2);
+    REQUIRE(parallel2.has_value());
+    REQUIRE(*parallel2 == *serial);
+    REQUIRE(evaluations == serialEvaluations);
+
+    auto parallel4 = integrate< Romberg >(f, { 0.0, 2.0 }, 1E-12, 25, &pool4);
+    REQUIRE(parallel4.has_value());
+    REQUIRE(*parallel4 == *serial);
+
+    auto trapezoid = integrate< Trapezoid >(f, { 0.0, 2.0 }, 1E-8);
+    REQUIRE(trapezoid.has_value());
+    REQUIRE(*integrate< Trapezoid >(f, { 0.0, 2.0 }, 1E-8, 25, &pool4) == *trapezoid);
+
+    auto simpson = integrate< Simpson >(f, { 0.0, 2.0 }, 1E-10);
+    REQUIRE(simpson.has_value());
+    REQUIRE(*integrate< Simpson >(f, { 0.0, 2.0 }, 1E-10, 25, &pool4) == *simpson);
+
+    evaluations       = 0;
+    auto gaussKronrod = integrate< GaussKronrod >(f, { 0.0, 2.0 }, 1E-12, 100);
+    REQUIRE(gaussKronrod.has_value());
+    const int gaussKronrodEvaluations = evaluations;
+    evaluations                       = 0;
+    REQUIRE(*integrate< GaussKronrod >(f, { 0.0, 2.0 }, 1E-12, 100, &pool4) == *gaussKronrod);
+    REQUIRE(evaluations == gaussKronrodEvaluations);
+
+    auto gaussKronrod21 = integrate< GaussKronrod21 >(f, { 0.0, 2.0 }, 1E-12, 100);
+    REQUIRE(gaussKronrod21.has_value());
+    REQUIRE(*integrate< GaussKronrod21 >(f, { 0.0, 2.0 }, 1E-12, 100, &pool4) == *gaussKronrod21);
+
+    // The integrand is singular at both endpoints, so the tails are cut at different nodes on either side.
+    auto singular = [](double x) { return std::log(x) / std::sqrt(1.0 - x); };
+    auto tanhSinh = integrate< TanhSinh >(singular, { 0.0, 1.0 }, 1E-10);
+    REQUIRE(tanhSinh.has_value());
+    REQUIRE(*integrate< TanhSinh >(singular, { 0.0, 1.0 }, 1E-10, 25, &pool2) == *tanhSinh);
+    REQUIRE(*integrate< TanhSinh >(singular, { 0.0, 1.0 }, 1E-10, 25, &pool4) == *tanhSinh);
+
+    // The thread pool is forwarded by the functor interface.
+    const auto integral = integralOf< Romberg >(f);
+    REQUIRE(integral({ 0.0, 2.0 }, 1E-12, 25, &pool4) == *serial);
+    REQUIRE(integral(std::pair{ 0.0, 2.0 }, 1E-12, 25, &pool2) == *serial);
+
+    // Exceptions thrown by the function are propagated to the caller.
+    auto throwing = [](double x) {
+        if (x > 1.2 && x < 1.3) throw std::runtime_error("Out of range");
+        return std::exp(x);
+    };
+    REQUIRE_THROWS_AS(integrate< Romberg >(throwing, { 0.0, 2.0 }, 1E-12, 25, &pool4), std::runtime_error);
+}
@@ -0,0 +1,1033 @@
+// ================================================================================================
+// Catch2 test file for the multiroots module.
+// ================================================================================================
+
+#include <Multiroots.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("nxx::multiroots - Steepest Descent Test", "[multiroots]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    // The gradient of the sum of squares is provided by reverse-mode automatic differentiation.
+    auto f1 = [](auto x) { return 3 * x[0] - cos(x[1] * x[2]) - 0.5; };
+    auto f2 = [](auto x) { return x[0] * x[0] - 81 * pow(x[1] + 0.1, 2.0) + sin(x[2]) + 1.06; };
+    auto f3 = [](auto x) { return exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3; };
+    auto g  = [&](auto x) { return f1(x) * f1(x) + f2(x) * f2(x) + f3(x) * f3(x); };
+
+    MultiFunctionArray functions { [&](std::span< double > s) { return f1(s); },
+                                   [&](std::span< double > s) { return f2(s); },
+                                   [&](std::span< double > s) { return f3(s); } };
+
+    const blaze::DynamicVector< double > x { 0.3, 0.2, 0.7 };
+    const blaze::DynamicVector< double > F    = functions.eval< blaze::DynamicVector >(x);
+    const blaze::DynamicVector< double > grad = 2.0 * blaze::trans(jacobian(functions, x)) * F;
+    const blaze::DynamicVector< double > ad   = gradient< ReverseAD >(g, x);
+    for (size_t i = 0; i < 3; ++i) REQUIRE_THAT(ad[i], Catch::Matchers::WithinRel(grad[i], 1E-6));
+
+    auto solver = SteepestDescent(functions, { 0.1, 0.1, -0.1 }, [&](const auto& point) { return gradient< ReverseAD >(g, point); });
+    auto result = multisolve(solver, 1E-10, 1000);
+    REQUIRE(result.has_value());
+    REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-8));
+    REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-8));
+    REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.5235987755982988, 1E-8));
+}
+
+TEST_CASE("nxx::multiroots - Broyden Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    auto f1 = [](std::span< double > x) { return 3 * x[0] - std::cos(x[1] * x[2]) - 0.5; };
+    auto f2 = [](std::span< double > x) { return x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06; };
+    auto f3 = [](std::span< double > x) { return std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3; };
+
+    MultiFunctionArray functions { f1, f2, f3 };
+    const std::vector< double > guess { 0.1, 0.1, -0.1 };
+
+    SECTION("Good Broyden")
+    {
+        auto result = multisolve< Broyden >(functions, guess, 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    }
+
+    SECTION("Bad Broyden")
+    {
+        auto result = multisolve< BroydenBad >(functions, { 0.1, 0.1, -0.1 }, 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Trust Region Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    auto f1 = [](std::span< double > x) { return 3 * x[0] - std::cos(x[1] * x[2]) - 0.5; };
+    auto f2 = [](std::span< double > x) { return x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06; };
+    auto f3 = [](std::span< double > x) { return std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3; };
+
+    MultiFunctionArray functions { f1, f2, f3 };
+
+    // A poor initial guess, from which MultiNewton does not converge on its own.
+    SECTION("Dogleg")
+    {
+        auto result = multisolve< Dogleg >(functions, { 2.0, 2.0, 2.0 }, 1E-12, 50);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    }
+
+    SECTION("Levenberg-Marquardt")
+    {
+        auto result = multisolve< LevenbergMarquardt >(functions, { 2.0, 2.0, 2.0 }, 1E-12, 50);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    }
+
+    // The full steps lead to x0 < 0, where the residual is NaN; such trial steps must be rejected, rather than
+    // retried indefinitely within a single iteration.
+    auto singular = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+        f[0] = std::sqrt(x[0]) + 10 * x[0] - 1E-8;
+        f[1] = x[1] - 1;
+    });
+
+    SECTION("Dogleg with non-finite residuals")
+    {
+        auto result = multisolve< Dogleg >(singular, { 0.5, 0.0 }, 1E-12, 50);
+        REQUIRE((!result || !result->converged));
+    }
+
+    SECTION("Levenberg-Marquardt with non-finite residuals")
+    {
+        auto result = multisolve< LevenbergMarquardt >(singular, { 0.5, 0.0 }, 1E-12, 50);
+        REQUIRE((!result || !result->converged));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Function System Test", "[multiroots]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    auto system = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+        const double cosyz = std::cos(x[1] * x[2]);
+        f[0]               = 3 * x[0] - cosyz - 0.5;
+        f[1]               = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2]               = std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3;
+    });
+
+    auto f1 = [](std::span< double > x) { return 3 * x[0] - std::cos(x[1] * x[2]) - 0.5; };
+    auto f2 = [](std::span< double > x) { return x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06; };
+    auto f3 = [](std::span< double > x) { return std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3; };
+
+    MultiFunctionArray functions { f1, f2, f3 };
+    const std::vector< double > guess { 0.1, 0.1, -0.1 };
+
+    SECTION("Evaluation and Jacobian")
+    {
+        auto fsys = system.eval< blaze::DynamicVector >(guess);
+        auto farr = functions.eval< blaze::DynamicVector >(guess);
+        for (size_t i = 0; i < 3; ++i) REQUIRE_THAT(fsys[i], Catch::Matchers::WithinAbs(farr[i], 1E-15));
+
+        std::vector< double > out(3);
+        system(guess, out);
+        REQUIRE_THAT(out[2], Catch::Matchers::WithinAbs(farr[2], 1E-15));
+
+        auto Jsys = jacobian(system, guess);
+        auto Jarr = jacobian(functions, guess);
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j) REQUIRE_THAT(Jsys(i, j), Catch::Matchers::WithinAbs(Jarr(i, j), 1E-8));
+    }
+
+    SECTION("Solvers")
+    {
+        auto check = [](const auto& result) {
+            REQUIRE(result.has_value());
+            REQUIRE(result->converged);
+            REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+            REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+            REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+        };
+
+        check(multisolve< MultiNewton >(system, guess, 1E-12, 100));
+        check(multisolve< Broyden >(system, guess, 1E-12, 100));
+        check(multisolve< BroydenBad >(system, { 0.1, 0.1, -0.1 }, 1E-12, 100));
+        check(multisolve< Dogleg >(system, { 2.0, 2.0, 2.0 }, 1E-12, 50));
+        check(multisolve< LevenbergMarquardt >(system, { 2.0, 2.0, 2.0 }, 1E-12, 50));
+        check(multisolve(MultiNewton(system, guess), 1E-12, 100));
+    }
+}
+
+TEST_CASE("nxx::multiroots - MultiFunction Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    const std::vector< double > x { 1.0, 2.0, 3.0 };
+
+    SECTION("Arguments are passed without copying")
+    {
+        const double* address = nullptr;
+        MultiFunction f([&address](std::span< const double > args) {
+            address = args.data();
+            return args[0] + args[1] * args[2];
+        });
+
+        REQUIRE(f(x) == 7.0);
+        REQUIRE(address == x.data());
+        REQUIRE(f(std::span< const double >(x)) == 7.0);
+        REQUIRE(f({ 2.0, 2.0, 2.0 }) == 6.0);
+        REQUIRE(f(std::vector< float > { 1.0F, 2.0F, 3.0F }) == 7.0);
+        REQUIRE(f(std::vector< float >(20, 1.0F)) == 2.0);
+    }
+
+    SECTION("Callables taking a mutable span get a copy")
+    {
+        MultiFunction f([](std::span< double > args) {
+            args[0] = 10.0;
+            return args[0] + args[1] * args[2];
+        });
+
+        REQUIRE(f(x) == 16.0);
+        REQUIRE(x[0] == 1.0);
+        REQUIRE(f(std::vector< double >(20, 1.0)) == 11.0);
+
+        std::vector< double > guess { 0.0, 1.0 };
+        auto                  result = multisolve< MultiNewton >(MultiFunctionArray { [](std::span< double > args) {
+                                                                     const double value = args[0] - 0.5;
+                                                                     args[0]            = 100.0;
+                                                                     return value;
+                                                                 },
+                                                                 [](std::span< double > args) { return args[1] - 2.0; } },
+                                                                 guess, 1E-12, 20);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-12));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(2.0, 1E-12));
+    }
+
+    SECTION("Small and large callables")
+    {
+        std::array< double, 16 > weights {};
+        weights.fill(2.0);
+
+        MultiFunction small([](std::span< const double > args) { return args[0]; });
+        MultiFunction large([weights](std::span< const double > args) { return weights[0] * args[0]; });
+
+        auto smallCopy = small;
+        auto largeCopy = large;
+        auto largeMove = std::move(large);
+        REQUIRE(smallCopy(x) == 1.0);
+        REQUIRE(largeCopy(x) == 2.0);
+        REQUIRE(largeMove(x) == 2.0);
+
+        largeCopy = smallCopy;
+        REQUIRE(largeCopy(x) == 1.0);
+    }
+
+    SECTION("Evaluation into preallocated storage")
+    {
+        MultiFunctionArray functions { [](std::span< double > args) { return args[0] * args[1]; },
+                                       [](std::span< double > args) { return args[2] - args[0]; } };
+
+        std::vector< double > out(2);
+        functions(x, out);
+        REQUIRE(out[0] == 2.0);
+        REQUIRE(out[1] == 2.0);
+        REQUIRE(functions.eval< std::vector >(std::vector< float > { 1.0F, 2.0F, 3.0F })[0] == 2.0);
+    }
+}
+
+TEST_CASE("nxx::multiroots - Newton-Krylov Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    SECTION("Small system")
+    {
+        auto f1 = [](std::span< double > x) { return 3 * x[0] - std::cos(x[1] * x[2]) - 0.5; };
+        auto f2 = [](std::span< double > x) { return x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06; };
+        auto f3 = [](std::span< double > x) { return std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3; };
+
+        MultiFunctionArray functions { f1, f2, f3 };
+
+        auto result = multisolve< NewtonKrylov >(functions, { 0.1, 0.1, -0.1 }, 1E-12, 50);
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    }
+
+    // The Broyden tridiagonal function, f_i = (3 - 2x_i) * x_i - x_{i-1} - 2 * x_{i+1} + 1, with x_0 = x_{n+1} = 0.
+    auto system = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+        const size_t n = x.size();
+        for (size_t i = 0; i < n; ++i) {
+            const double left  = i > 0 ? x[i - 1] : 0.0;
+            const double right = i + 1 < n ? x[i + 1] : 0.0;
+            f[i]               = (3 - 2 * x[i]) * x[i] - left - 2 * right + 1;
+        }
+    });
+
+    const std::vector< double > guess(500, -1.0);
+
+    SECTION("Large system")
+    {
+        auto result = multisolve< NewtonKrylov >(system, guess, 1E-10, 50);
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE(result->iterations < 20);
+        REQUIRE(norm(system.eval< blaze::DynamicVector >(result->root)) < 1E-10);
+    }
+
+    SECTION("Large system, preconditioned")
+    {
+        // Jacobi preconditioner; the diagonal of the Jacobian is 3 - 4x_i.
+        auto jacobi = [](const blaze::DynamicVector< double >& x, const blaze::DynamicVector< double >& v) {
+            blaze::DynamicVector< double > result(v.size());
+            for (size_t i = 0; i < v.size(); ++i) result[i] = v[i] / (3 - 4 * x[i]);
+            return result;
+        };
+
+        auto result = multisolve(NewtonKrylov(system, guess, jacobi, 10), 1E-10, 50);
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE(norm(system.eval< blaze::DynamicVector >(result->root)) < 1E-10);
+    }
+}
+
+TEST_CASE("nxx::multiroots - Chord Newton Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    int  evaluations = 0;
+    auto system      = MultiFunctionSystem([&evaluations](std::span< const double > x, std::span< double > f) {
+        ++evaluations;
+        f[0] = 3 * x[0] - std::cos(x[1] * x[2]) - 0.5;
+        f[1] = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2] = std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3;
+    });
+
+    const std::vector< double > guess { 0.1, 0.1, -0.1 };
+
+    auto check = [](const auto& result) {
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    };
+
+    check(multisolve< MultiNewton >(system, guess, 1E-12, 100));
+    const int newtonEvaluations = evaluations;
+
+    evaluations = 0;
+    check(multisolve< ChordNewton >(system, guess, 1E-12, 100));
+    REQUIRE(evaluations < newtonEvaluations);
+
+    SECTION("Newton's method as a special case")
+    {
+        check(multisolve(ChordNewton(system, guess, 1), 1E-12, 100));
+        check(multisolve(ChordNewton(system, { 0.1, 0.1, -0.1 }, 100, 0.9), 1E-12, 100));
+    }
+}
+
+namespace
+{
+    // Whether multisolve<SOLVER_T, N> can be called for a system of three equations.
+    template< template< typename, typename > class SOLVER_T, typename SYSTEM_T >
+    constexpr bool acceptsFixedSize = requires(SYSTEM_T system, std::vector< double > guess) { multisolve< SOLVER_T, 3 >(system, guess); };
+}    // namespace
+
+TEST_CASE("nxx::multiroots - Fixed-Size Test", "[multiroots]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    auto system = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+        f[0] = 3 * x[0] - std::cos(x[1] * x[2]) - 0.5;
+        f[1] = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2] = std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3;
+    });
+
+    auto check = [](const auto& result) {
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    };
+
+    SECTION("Jacobian")
+    {
+        const std::vector< double > guess { 0.1, 0.1, -0.1 };
+        auto                        Jfix = jacobian(StaticMultiFunction< decltype(system), 3 >(system), guess);
+        auto                        Jdyn = jacobian(system, guess);
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j) REQUIRE_THAT(Jfix(i, j), Catch::Matchers::WithinAbs(Jdyn(i, j), 1E-12));
+    }
+
+    SECTION("Function system and function array")
+    {
+        auto result = multisolve< MultiNewton, 3 >(system, { 0.1, 0.1, -0.1 }, 1E-12, 100);
+        static_assert(std::is_same_v< decltype(result->root), blaze::StaticVector< double, 3 > >);
+
+        // Only MultiNewton keeps all of its temporaries in fixed-size storage; the other solvers are rejected.
+        using SYSTEM = decltype(system);
+        static_assert(acceptsFixedSize< MultiNewton, SYSTEM >);
+        static_assert(!acceptsFixedSize< ChordNewton, SYSTEM >);
+        static_assert(!acceptsFixedSize< SteepestDescent, SYSTEM >);
+        static_assert(!acceptsFixedSize< Broyden, SYSTEM >);
+        static_assert(!acceptsFixedSize< BroydenBad, SYSTEM >);
+        static_assert(!acceptsFixedSize< Dogleg, SYSTEM >);
+        static_assert(!acceptsFixedSize< LevenbergMarquardt, SYSTEM >);
+        static_assert(!acceptsFixedSize< NewtonKrylov, SYSTEM >);
+        static_assert(!acceptsFixedSize< Anderson, SYSTEM >);
+        check(result);
+
+        auto f1 = [](std::span< double > x) { return 3 * x[0] - std::cos(x[1] * x[2]) - 0.5; };
+        auto f2 = [](std::span< double > x) { return x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06; };
+        auto f3 = [](std::span< double > x) { return std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3; };
+        check(multisolve< MultiNewton, 3 >(MultiFunctionArray { f1, f2, f3 }, std::vector { 0.1, 0.1, -0.1 }, 1E-12, 100));
+    }
+
+    SECTION("Small and larger systems")
+    {
+        // Two equations (Cramer's rule); the root is (1, 2).
+        auto circle = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+            f[0] = x[0] * x[0] + x[1] * x[1] - 5;
+            f[1] = x[1] - 2 * x[0];
+        });
+        auto result = multisolve< MultiNewton, 2 >(circle, { 1.5, 1.5 }, 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(1.0, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(2.0, 1E-10));
+
+        // Broyden tridiagonal function with six unknowns (Gaussian elimination); compared against the dynamic solver.
+        auto tridiagonal = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+            const size_t n = x.size();
+            for (size_t i = 0; i < n; ++i) {
+                const double left  = i > 0 ? x[i - 1] : 0.0;
+                const double right = i + 1 < n ? x[i + 1] : 0.0;
+                f[i]               = (3 - 2 * x[i]) * x[i] - left - 2 * right + 1;
+            }
+        });
+        const std::vector< double > guess(6, -1.0);
+        auto                        fixed   = multisolve< MultiNewton, 6 >(tridiagonal, guess, 1E-12, 100);
+        auto                        dynamic = multisolve< MultiNewton >(tridiagonal, guess, 1E-12, 100);
+        REQUIRE(fixed.has_value());
+        REQUIRE(fixed->converged);
+        REQUIRE(fixed->iterations == dynamic->iterations);
+        for (size_t i = 0; i < 6; ++i) REQUIRE_THAT(fixed->root[i], Catch::Matchers::WithinAbs(dynamic->root[i], 1E-10));
+    }
+
+    SECTION("Size mismatch")
+    {
+        REQUIRE_THROWS(multisolve< MultiNewton, 3 >(system, { 0.1, 0.1 }));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Batch Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    struct Params
+    {
+        double a;
+        double b;
+    };
+
+    auto system = [](std::span< const double > x, const Params& p, std::span< double > f) {
+        f[0] = 3 * x[0] - std::cos(x[1] * x[2]) - p.a;
+        f[1] = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2] = std::exp(-x[0] * x[1]) + 20 * x[2] + p.b;
+    };
+
+    std::vector< Params > params;
+    for (size_t i = 0; i < 21; ++i) params.push_back({ 0.3 + 0.02 * static_cast< double >(i), 9.47 + 0.01 * static_cast< double >(i) });
+    params[5].a = std::numeric_limits< double >::quiet_NaN();
+
+    const std::vector< std::array< double, 3 > >                           guesses(params.size(), { 0.1, 0.1, -0.1 });
+    std::vector< MultirootResult< double, blaze::StaticVector< double, 3 > > > results(params.size());
+
+    auto check = [&]() {
+        for (size_t k = 0; k < params.size(); ++k) {
+            auto single = MultiFunctionSystem([&](std::span< const double > x, std::span< double > f) { system(x, params[k], f); });
+            auto scalar = multisolve< MultiNewton, 3 >(single, { 0.1, 0.1, -0.1 }, 1E-12, 100);
+            if (k == 5) {
+                REQUIRE(!scalar.has_value());
+                REQUIRE(!results[k].converged);
+                continue;
+            }
+            REQUIRE(results[k].converged);
+            REQUIRE(results[k].iterations == scalar->iterations);
+            for (size_t i = 0; i < 3; ++i) REQUIRE_THAT(results[k].root[i], Catch::Matchers::WithinAbs(scalar->root[i], 1E-12));
+        }
+    };
+
+    SECTION("Serial")
+    {
+        REQUIRE(multisolve_batch< MultiNewton, 3 >(system, params, guesses, results, 1E-12, 100) == params.size() - 1);
+        check();
+    }
+
+    SECTION("Thread pool")
+    {
+        nxx::ThreadPool pool(3);
+        REQUIRE(multisolve_batch< MultiNewton, 3 >(system, params, guesses, results, 1E-12, 100, &pool) == params.size() - 1);
+        check();
+    }
+
+    SECTION("Size mismatch")
+    {
+        results.pop_back();
+        REQUIRE_THROWS(multisolve_batch< MultiNewton, 3 >(system, params, guesses, results));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Line Search Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    // A one-dimensional merit function phi(alpha) = (alpha - 3)^2 + alpha^4 / 10, counting the evaluations.
+    struct Phi
+    {
+        int    evaluations = 0;
+        double alpha       = 0.0;
+
+        double operator()(double a)
+        {
+            ++evaluations;
+            alpha = a;
+            return (a - 3) * (a - 3) + a * a * a * a / 10;
+        }
+
+        double derivative() const { return 2 * (alpha - 3) + 0.4 * alpha * alpha * alpha; }
+    };
+
+    SECTION("Armijo backtracking")
+    {
+        Phi          phi;
+        const double alpha = ArmijoBacktracking< double >()(phi, 9.0, -6.0, 10.0);
+        REQUIRE(phi.alpha == alpha);
+        REQUIRE(phi(alpha) <= 9.0 - 1E-4 * 6.0 * alpha);
+    }
+
+    SECTION("More-Thuente")
+    {
+        Phi          phi;
+        const double alpha = MoreThuente< double >(1E-4, 0.1)(phi, 9.0, -6.0, 0.1);
+        REQUIRE(phi.alpha == alpha);
+        REQUIRE(phi(alpha) <= 9.0 - 1E-4 * 6.0 * alpha);
+        REQUIRE(std::abs(phi.derivative()) <= 0.1 * 6.0);
+    }
+
+    // Newton's method overshoots for arctan, if the initial guess is too far from the root.
+    auto system = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+        f[0] = std::atan(x[0]);
+        f[1] = std::atan(x[1] - 1);
+    });
+
+    SECTION("Damped Newton")
+    {
+        // The undamped iterates diverge, until the Jacobian becomes (numerically) singular.
+        bool undampedConverged = false;
+        try {
+            auto undamped     = multisolve< MultiNewton >(system, { 3.0, 4.0 }, 1E-12, 50);
+            undampedConverged = undamped.has_value() && undamped->converged;
+        }
+        catch (...) {
+        }
+        REQUIRE(!undampedConverged);
+
+        for (auto result : { multisolve(MultiNewton(system, { 3.0, 4.0 }, ArmijoBacktracking< double >()), 1E-12, 50),
+                             multisolve(MultiNewton(system, { 3.0, 4.0 }, MoreThuente< double >()), 1E-12, 50) }) {
+            REQUIRE(result.has_value());
+            REQUIRE(result->converged);
+            REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.0, 1E-10));
+            REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(1.0, 1E-10));
+        }
+    }
+
+    SECTION("Failed line search")
+    {
+        // With a Jacobian of the wrong sign, the Newton direction is an ascent direction, and the search must fail.
+        auto wrong = MultiFunctionSystem([](std::span< const double > x, std::span< double > f) {
+                                              f[0] = x[0] - 1;
+                                              f[1] = x[1] + 2;
+                                          },
+                                          [](std::span< const double >, auto& J) {
+                                              J(0, 0) = -1;
+                                              J(1, 1) = -1;
+                                          });
+
+        auto result = multisolve(MultiNewton(wrong, { 0.0, 0.0 }, ArmijoBacktracking< double >()), 1E-12, 100);
+        REQUIRE_FALSE(result.has_value());
+    }
+
+    SECTION("Accepted trial points are not evaluated again")
+    {
+        int  evaluations = 0;
+        auto counted     = MultiFunctionSystem([&](std::span< const double > x, std::span< double > f) {
+            ++evaluations;
+            f[0] = 3 * x[0] - std::cos(x[1] * x[2]) - 0.5;
+            f[1] = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+            f[2] = std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3;
+        });
+
+        auto plain            = multisolve< MultiNewton >(counted, { 0.1, 0.1, -0.1 }, 1E-12, 100);
+        const int newtonCount = evaluations;
+
+        evaluations = 0;
+        auto damped = multisolve(MultiNewton(counted, { 0.1, 0.1, -0.1 }, ArmijoBacktracking< double >()), 1E-12, 100);
+        REQUIRE(damped->converged);
+        REQUIRE(damped->iterations == plain->iterations);
+        REQUIRE(evaluations == newtonCount);
+    }
+
+    SECTION("Steepest descent")
+    {
+        const auto start = std::vector { 3.0, 4.0 };
+        for (auto result : { multisolve< SteepestDescent >(system, start, 1E-6, 200),
+                             multisolve(SteepestDescent(system, start, MoreThuente< double >()), 1E-6, 200) }) {
+            REQUIRE(result.has_value());
+            REQUIRE(result->converged);
+            REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.0, 1E-5));
+            REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(1.0, 1E-5));
+        }
+    }
+}
+
+TEST_CASE("nxx::multiroots - Block Decomposition Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    // A reducible system, with the equations in scrambled order. The solution is x = (1, 2, 3, 1, sqrt(3)).
+    auto f0 = [](std::span< double > x) { return x[4] * x[4] - x[2]; };
+    auto f1 = [](std::span< double > x) { return x[2] - x[3] - x[1]; };
+    auto f2 = [](std::span< double > x) { return x[0] - 1; };
+    auto f3 = [](std::span< double > x) { return x[2] + x[3] - 3 - x[0]; };
+    auto f4 = [](std::span< double > x) { return x[0] * x[1] - 2; };
+
+    MultiFunctionArray          functions { f0, f1, f2, f3, f4 };
+    const std::vector< double > guess { 0.5, 0.5, 0.5, 0.5, 0.5 };
+
+    const IncidencePattern declared { { 2, 4 }, { 1, 2, 3 }, { 0 }, { 0, 2, 3 }, { 0, 1 } };
+
+    SECTION("Decomposition")
+    {
+        auto probed = probeIncidence(functions, guess);
+        for (auto& vars : probed) std::sort(vars.begin(), vars.end());
+        REQUIRE(probed == declared);
+
+        const auto blocks = decompose(declared);
+        REQUIRE(blocks.size() == 4);
+        REQUIRE(blocks[0].equations == std::vector< size_t > { 2 });
+        REQUIRE(blocks[0].variables == std::vector< size_t > { 0 });
+        REQUIRE(blocks[1].equations == std::vector< size_t > { 4 });
+        REQUIRE(blocks[1].variables == std::vector< size_t > { 1 });
+        REQUIRE(blocks[2].equations == std::vector< size_t > { 1, 3 });
+        REQUIRE(blocks[3].equations == std::vector< size_t > { 0 });
+        REQUIRE(blocks[3].variables == std::vector< size_t > { 4 });
+    }
+
+    SECTION("Block by block solution")
+    {
+        auto result = multisolve< MultiNewton >(functions, guess, decompose(declared), 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE(result->residual < 1E-10);
+        const std::vector< double > expected { 1.0, 2.0, 3.0, 1.0, std::sqrt(3.0) };
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(result->root[i], Catch::Matchers::WithinAbs(expected[i], 1E-10));
+
+        auto full = multisolve< MultiNewton >(functions, guess, 1E-12, 100);
+        for (size_t i = 0; i < 5; ++i) REQUIRE_THAT(result->root[i], Catch::Matchers::WithinAbs(full->root[i], 1E-10));
+    }
+
+    SECTION("Long chain of equations")
+    {
+        // Equation i depends on variables i-1 and i, so the system splits into 5000 scalar blocks solved in order.
+        IncidencePattern chain(5000);
+        for (size_t i = 0; i < chain.size(); ++i) chain[i] = i == 0 ? std::vector< size_t > { 0 } : std::vector< size_t > { i, i - 1 };
+
+        const auto blocks = decompose(chain);
+        REQUIRE(blocks.size() == 5000);
+        for (size_t i = 0; i < blocks.size(); ++i) REQUIRE(blocks[i].equations.front() == i);
+    }
+
+    SECTION("Structurally singular system")
+    {
+        REQUIRE_THROWS(decompose(IncidencePattern { { 0 }, { 0 } }));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Parallel Evaluation Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    // Ten equations, each made artificially expensive by a slowly converging series.
+    auto equation = [](size_t i) {
+        return [i](std::span< const double > x) {
+            double series = 0.0;
+            for (int k = 1; k <= 2000; ++k) series += std::sin(x[i] * k) / (static_cast< double >(k) * k * k);
+            const double next = i + 1 < 10 ? x[i + 1] : 0.0;
+            return 2 * x[i] - next + 1E-3 * series - 1.0;
+        };
+    };
+
+    MultiFunctionArray< double, double > serial;
+    MultiFunctionArray< double, double > parallel;
+    for (size_t i = 0; i < 10; ++i) {
+        serial.addFunction(equation(i));
+        parallel.addFunction(equation(i));
+    }
+
+    nxx::ThreadPool pool(4);
+    const std::vector< double > point { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0 };
+
+    SECTION("Evaluation and Jacobian")
+    {
+        parallel.setExecutor(&pool, std::chrono::nanoseconds(0));
+        REQUIRE(parallel.executor() == nullptr);    // The cost is measured by the first evaluation.
+        REQUIRE(parallel(point) == serial(point));
+        REQUIRE(parallel.executor() == &pool);
+
+        std::vector< double > values(10);
+        parallel(std::span< const double >(point), std::span< double >(values));
+        REQUIRE(values == serial(point));
+
+        const auto J = nxx::deriv::jacobian(parallel, point);
+        const auto K = nxx::deriv::jacobian(serial, point);
+        for (size_t i = 0; i < 10; ++i)
+            for (size_t j = 0; j < 10; ++j) REQUIRE(J(i, j) == K(i, j));
+    }
+
+    SECTION("Solvers")
+    {
+        parallel.setExecutor(&pool, std::chrono::nanoseconds(0));
+        auto result   = multisolve< MultiNewton >(parallel, point, 1E-12, 100);
+        auto expected = multisolve< MultiNewton >(serial, point, 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE(result->iterations == expected->iterations);
+        for (size_t i = 0; i < 10; ++i) REQUIRE(result->root[i] == expected->root[i]);
+    }
+
+    SECTION("Cheap systems stay serial")
+    {
+        parallel.setExecutor(&pool, std::chrono::seconds(1));
+        REQUIRE(parallel(point) == serial(point));
+        REQUIRE(parallel.executor() == nullptr);
+
+        parallel.setExecutor(nullptr);
+        REQUIRE(parallel.executor() == nullptr);
+    }
+}
+
+TEST_CASE("nxx::multiroots - Anderson Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    // The fixed-point problem x = g(x), with a contraction factor close to one, written as f(x) = g(x) - x.
+    const size_t n      = 20;
+    auto         system = MultiFunctionSystem([n](std::span< const double > x, std::span< double > f) {
+        for (size_t i = 0; i < n; ++i) {
+            const double left  = i > 0 ? x[i - 1] : 0.0;
+            const double right = i + 1 < n ? x[i + 1] : 0.0;
+            f[i]               = 0.95 * (left + right) / 2 + 0.1 + 0.02 * std::sin(x[i]) - x[i];
+        }
+    });
+
+    const std::vector< double > guess(n, 0.0);
+    const auto                  expected = multisolve< MultiNewton >(system, guess, 1E-12, 100);
+    REQUIRE(expected.has_value());
+
+    auto check = [&](const auto& result) {
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        for (size_t i = 0; i < n; ++i) REQUIRE_THAT(result->root[i], Catch::Matchers::WithinAbs(expected->root[i], 1E-10));
+    };
+
+    const auto plain = multisolve(Anderson(system, guess, 0), 1E-12, 10000);
+    check(plain);
+
+    SECTION("Acceleration")
+    {
+        const auto accelerated = multisolve< Anderson >(system, guess, 1E-12, 1000);
+        check(accelerated);
+        REQUIRE(accelerated->iterations < plain->iterations);
+
+        const auto deeper = multisolve(Anderson(system, guess, 10), 1E-12, 1000);
+        check(deeper);
+        REQUIRE(deeper->iterations * 10 < plain->iterations);
+    }
+
+    SECTION("Mixing")
+    {
+        check(multisolve(Anderson(system, guess, 3, 0.5), 1E-12, 1000));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Mixed Precision Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    SECTION("Large system")
+    {
+        // A diagonally dominant, weakly nonlinear system with 60 unknowns.
+        const size_t n      = 60;
+        auto         system = MultiFunctionSystem([n](std::span< const double > x, std::span< double > f) {
+            for (size_t i = 0; i < n; ++i) {
+                const double left  = i > 0 ? x[i - 1] : 0.0;
+                const double right = i + 1 < n ? x[i + 1] : 0.0;
+                f[i]               = 3 * x[i] - left - right + 0.1 * x[i] * x[i] * x[i] - 1.0;
+            }
+        });
+
+        const std::vector< double > guess(n, 0.0);
+        const auto                  expected = multisolve< MultiNewton >(system, guess, 1E-12, 100);
+        const auto                  result   = multisolve(MultiNewton(system, guess, MixedPrecision {}), 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE(result->iterations == expected->iterations);
+        for (size_t i = 0; i < n; ++i) REQUIRE_THAT(result->root[i], Catch::Matchers::WithinRel(expected->root[i], 1E-12));
+
+        const auto damped = multisolve(MultiNewton(system, guess, ArmijoBacktracking< double > {}, MixedPrecision { 5 }), 1E-12, 100);
+        REQUIRE(damped.has_value());
+        for (size_t i = 0; i < n; ++i) REQUIRE_THAT(damped->root[i], Catch::Matchers::WithinRel(expected->root[i], 1E-12));
+    }
+
+    SECTION("Ill-conditioned system")
+    {
+        // A linear system with the 10x10 Hilbert matrix (condition number ~1E13); the refinement in float cannot
+        // converge, so the step must come from the fallback to a factorization in double.
+        const size_t                   n = 10;
+        blaze::DynamicMatrix< double > H(n, n);
+        blaze::DynamicVector< double > x(n), b(n, 0.0);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = 1.0 + static_cast< double >(i);
+            for (size_t j = 0; j < n; ++j) H(i, j) = 1.0 / static_cast< double >(i + j + 1);
+        }
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j) b[i] += H(i, j) * x[j];
+
+        const auto solution  = detail::solveMixedPrecision(H, b, 10);
+        const auto reference = detail::solveLinear(H, b);
+        for (size_t i = 0; i < n; ++i) REQUIRE(solution[i] == reference[i]);
+
+        // A well-conditioned system is solved to full precision by the refinement.
+        for (size_t i = 0; i < n; ++i) H(i, i) += 10.0;
+        const auto refined = detail::solveMixedPrecision(H, b, 10);
+        const auto direct  = detail::solveLinear(H, b);
+        for (size_t i = 0; i < n; ++i) REQUIRE_THAT(refined[i], Catch::Matchers::WithinRel(direct[i], 1E-14));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Continuation Test", "[multiroots]")
+{
+    using namespace nxx::multiroots;
+
+    auto residual = [](const auto& system, const ContinuationPoint< double >& point) {
+        std::vector< double > f(point.x.size());
+        system(std::span< const double >(point.x.data(), point.x.size()), point.lambda, std::span< double >(f));
+        double norm = 0.0;
+        for (auto v : f) norm = std::max(norm, std::abs(v));
+        return norm;
+    };
+
+    SECTION("Natural parameter")
+    {
+        // x_i^3 + x_i = (i + 1) * lambda has a unique solution for each lambda.
+        auto system = [](std::span< const double > x, double lambda, std::span< double > f) {
+            for (size_t i = 0; i < x.size(); ++i) f[i] = x[i] * x[i] * x[i] + x[i] - static_cast< double >(i + 1) * lambda;
+        };
+
+        ContinuationSettings< double > settings;
+        settings.mode = ContinuationMode::NaturalParameter;
+
+        const auto result = continuation(system, std::vector< double >(5, 0.5), 0.0, 2.0, settings);
+        REQUIRE(result.completed);
+        REQUIRE(result.branch.front().lambda == 0.0);
+        REQUIRE_THAT(result.branch.back().lambda, Catch::Matchers::WithinAbs(2.0, 1E-14));
+
+        size_t corrections = 0;
+        for (size_t k = 0; k < result.branch.size(); ++k) {
+            REQUIRE(residual(system, result.branch[k]) < 1E-9);
+            if (k > 0) {
+                REQUIRE(result.branch[k].lambda > result.branch[k - 1].lambda);
+                corrections += result.branch[k].corrections;
+            }
+        }
+        REQUIRE(corrections <= 4 * (result.branch.size() - 1));
+    }
+
+    SECTION("Pseudo-arclength around turning points")
+    {
+        // lambda = x^3 - x has turning points at x = -+1/sqrt(3); the branch starting at lambda = -1 on the lower
+        // part of the S-shaped curve reaches lambda = 1 on the upper part only by following both folds.
+        auto system = [](std::span< const double > x, double lambda, std::span< double > f) {
+            f[0] = x[0] * x[0] * x[0] - x[0] - lambda;
+            f[1] = x[1] - x[0] * x[0];
+        };
+
+        const auto result = continuation(system, { -1.3, 1.7 }, -1.0, 1.0);
+        REQUIRE(result.completed);
+        REQUIRE_THAT(result.branch.back().lambda, Catch::Matchers::WithinAbs(1.0, 1E-14));
+        REQUIRE_THAT(result.branch.back().x[0], Catch::Matchers::WithinAbs(1.324717957244746, 1E-9));
+
+        size_t turns = 0;
+        for (size_t k = 0; k < result.branch.size(); ++k) {
+            REQUIRE(residual(system, result.branch[k]) < 1E-9);
+            if (k > 1) {
+                const double before = result.branch[k - 1].lambda - result.branch[k - 2].lambda;
+                const double after  = result.branch[k].lambda - result.branch[k - 1].lambda;
+                if (before * after < 0) ++turns;
+            }
+        }
+        REQUIRE(turns == 2);
+
+        // The natural parameter continuation cannot pass the first turning point.
+        ContinuationSettings< double > settings;
+        settings.mode = ContinuationMode::NaturalParameter;
+        const auto natural = continuation(system, { -1.3, 1.7 }, -1.0, 1.0, settings);
+        REQUIRE(!natural.completed);
+        REQUIRE(natural.branch.back().lambda < 0.385);
+    }
+
+    SECTION("Invalid initial guess")
+    {
+        auto system = [](std::span< const double > x, double lambda, std::span< double > f) { f[0] = x[0] * x[0] + 1.0 + lambda * 0.0; };
+        REQUIRE_THROWS(continuation(system, { 1.0 }, 0.0, 1.0));
+    }
+}
+
+TEST_CASE("nxx::multiroots - Analytic Jacobian Test", "[multiroots]")
+{
+    using namespace nxx::deriv;
+    using namespace nxx::multiroots;
+
+    int  evaluations = 0;
+    int  jacobians   = 0;
+    auto function    = [&evaluations](std::span< const double > x, std::span< double > f) {
+        ++evaluations;
+        f[0] = 3 * x[0] - std::cos(x[1] * x[2]) - 0.5;
+        f[1] = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2] = std::exp(-x[0] * x[1]) + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3;
+    };
+    auto derivatives = [](std::span< const double > x, auto& J) {
+        J(0, 0) = 3;
+        J(0, 1) = x[2] * std::sin(x[1] * x[2]);
+        J(0, 2) = x[1] * std::sin(x[1] * x[2]);
+        J(1, 0) = 2 * x[0];
+        J(1, 1) = -162 * (x[1] + 0.1);
+        J(1, 2) = std::cos(x[2]);
+        J(2, 0) = -x[1] * std::exp(-x[0] * x[1]);
+        J(2, 1) = -x[0] * std::exp(-x[0] * x[1]);
+        J(2, 2) = 20;
+    };
+
+    auto plain    = MultiFunctionSystem(function);
+    auto analytic = MultiFunctionSystem(function, [&](std::span< const double > x, auto& J) {
+        ++jacobians;
+        derivatives(x, J);
+    });
+    auto fused    = MultiFunctionSystem(function, [&](std::span< const double > x, std::span< double > f, auto& J) {
+        ++jacobians;
+        const double e = std::exp(-x[0] * x[1]);
+        f[0]           = 3 * x[0] - std::cos(x[1] * x[2]) - 0.5;
+        f[1]           = x[0] * x[0] - 81 * std::pow(x[1] + 0.1, 2) + std::sin(x[2]) + 1.06;
+        f[2]           = e + 20 * x[2] + (10 * 3.14159265358979 - 3) / 3;
+        derivatives(x, J);
+    });
+
+    static_assert(!HasJacobian< decltype(plain) >);
+    static_assert(HasJacobian< decltype(analytic) > && HasJacobian< decltype(fused) >);
+
+    const std::vector< double > guess { 0.1, 0.1, -0.1 };
+
+    auto check = [](const auto& result) {
+        REQUIRE(result.has_value());
+        REQUIRE(result->converged);
+        REQUIRE_THAT(result->root[0], Catch::Matchers::WithinAbs(0.5, 1E-10));
+        REQUIRE_THAT(result->root[1], Catch::Matchers::WithinAbs(0.0, 1E-10));
+        REQUIRE_THAT(result->root[2], Catch::Matchers::WithinAbs(-0.52359877559, 1E-10));
+    };
+
+    SECTION("Jacobian")
+    {
+        const auto Jfd  = jacobian(plain, guess);
+        const auto Jan  = jacobian(analytic, guess);
+        const auto Jfu  = jacobian(fused, guess);
+        const auto Jfix = jacobian(StaticMultiFunction< decltype(fused), 3 >(fused), guess);
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 3; ++j) {
+                REQUIRE_THAT(Jan(i, j), Catch::Matchers::WithinAbs(Jfd(i, j), 1E-8));
+                REQUIRE(Jfu(i, j) == Jan(i, j));
+                REQUIRE(Jfix(i, j) == Jan(i, j));
+            }
+        REQUIRE(jacobians == 3);
+    }
+
+    SECTION("Newton's method")
+    {
+        evaluations = 0;
+        check(multisolve< MultiNewton >(plain, guess, 1E-12, 100));
+        const int finiteDifferences = evaluations;
+
+        // Without finite differences, only the function values at the iterates are computed.
+        evaluations = 0;
+        jacobians   = 0;
+        check(multisolve< MultiNewton >(analytic, guess, 1E-12, 100));
+        REQUIRE(evaluations == jacobians + 1);
+        REQUIRE(evaluations * 10 < finiteDifferences);
+
+        // With a fused Jacobian, the function values are computed along with the Jacobian at each new iterate.
+        evaluations = 0;
+        jacobians   = 0;
+        check(multisolve< MultiNewton >(fused, guess, 1E-12, 100));
+        REQUIRE(evaluations == 1);
+        check(multisolve< MultiNewton, 3 >(fused, { 0.1, 0.1, -0.1 }, 1E-12, 100));
+    }
+
+    SECTION("Other solvers")
+    {
+        check(multisolve< ChordNewton >(analytic, guess, 1E-12, 100));
+        check(multisolve< Broyden >(fused, guess, 1E-12, 100));
+        check(multisolve< Dogleg >(analytic, guess, 1E-12, 100));
+        check(multisolve< LevenbergMarquardt >(fused, guess, 1E-12, 100));
+        check(multisolve(MultiNewton(analytic, guess, ArmijoBacktracking< double >()), 1E-12, 100));
+
+        // Newton-Krylov uses the analytic Jacobian for the products J * v, so the functions are only evaluated at the iterates.
+        evaluations = 0;
+        jacobians   = 0;
+        check(multisolve< NewtonKrylov >(analytic, guess, 1E-12, 100));
+        REQUIRE(evaluations == jacobians + 1);
+
+        const blaze::DynamicVector< double > x { 0.1, 0.1, -0.1 };
+        const blaze::DynamicVector< double > v { 1.0, -2.0, 0.5 };
+        const auto                           exact  = jvp(analytic, x, v, analytic.eval< blaze::DynamicVector >(x));
+        const auto                           approx = jvp(plain, x, v, plain.eval< blaze::DynamicVector >(x));
+        for (size_t i = 0; i < 3; ++i) REQUIRE_THAT(exact[i], Catch::Matchers::WithinAbs(approx[i], 1E-4));
+
+        evaluations = 0;
+        jacobians   = 0;
+        auto result = multisolve< SteepestDescent >(analytic, guess, 1E-6, 1000);
+        REQUIRE(result.has_value());
+        REQUIRE(jacobians > 0);
+    }
+}
@@ -0,0 +1,57 @@
+// ================================================================================================
+// Catch2 test file for the fixed-point solvers.
+// ================================================================================================
+
+#include <Roots.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+TEST_CASE("nxx::roots - Fixed-Point Test", "[roots]")
+{
+    using namespace nxx::roots;
+
+    const double dottie = 0.739085133215160641655312087673873404;
+
+    int  evaluations = 0;
+    auto g           = [&evaluations](double x) {
+        ++evaluations;
+        return std::cos(x);
+    };
+
+    SECTION("Plain iteration")
+    {
+        auto result = fpsolve< FixedPoint >(g, 1.0, 1E-12, 1000);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(dottie, 1E-11));
+        REQUIRE(evaluations > 50);
+    }
+
+    SECTION("Aitken acceleration")
+    {
+        auto result = fpsolve< Aitken >(g, 1.0, 1E-12, 1000);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(dottie, 1E-14));
+        REQUIRE(evaluations < 15);
+    }
+
+    SECTION("Repelling fixed point")
+    {
+        // The plain iteration diverges, as |g'| > 1, but the accelerated iteration converges.
+        auto h = [](double x) { return 3 * x - 2 + 0.1 * std::sin(x - 1); };
+        REQUIRE(!fpsolve< FixedPoint >(h, 1.5, 1E-12, 1000).has_value());
+
+        auto result = fpsolve< Aitken >(h, 1.5, 1E-12, 100);
+        REQUIRE(result.has_value());
+        REQUIRE_THAT(*result, Catch::Matchers::WithinAbs(1.0, 1E-12));
+    }
+
+    SECTION("Maximum number of iterations")
+    {
+        auto result = fpsolve< FixedPoint >(g, 1.0, 1E-12, 10);
+        REQUIRE(!result.has_value());
+        REQUIRE(result.error().type() == RootErrorType::MaxIterationsExceeded);
+        REQUIRE(result.error().iterations() == 10);
+    }
+}